@@ -1,6 +1,7 @@
 // Generated by using Rcpp::compileAttributes() -> do not edit by hand
 // Generator token: 10BE3573-1514-4C36-9D1C-5A225CD40393
 
+#include "rcppassignment_types.h"
 #include <Rcpp.h>
 
 using namespace Rcpp;
@@ -10,21 +11,527 @@ Rcpp::Rostream<true>&  Rcpp::Rcout = Rcpp::Rcpp_cout_get();
 Rcpp::Rostream<false>& Rcpp::Rcerr = Rcpp::Rcpp_cerr_get();
 #endif
 
-// dotproduct
-std::vector<double> dotproduct(const std::vector<double>& a, const std::vector<double>& b);
-RcppExport SEXP _rcppassignment_dotproduct(SEXP aSEXP, SEXP bSEXP) {
+// bootstrap_hulls
+List bootstrap_hulls(NumericVector x, NumericVector y, int replicates);
+RcppExport SEXP _rcppassignment_bootstrap_hulls(SEXP xSEXP, SEXP ySEXP, SEXP replicatesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< const std::vector<double>& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const std::vector<double>& >::type b(bSEXP);
-    rcpp_result_gen = Rcpp::wrap(dotproduct(a, b));
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< int >::type replicates(replicatesSEXP);
+    rcpp_result_gen = Rcpp::wrap(bootstrap_hulls(x, y, replicates));
     return rcpp_result_gen;
 END_RCPP
 }
+// convex_minorant
+List convex_minorant(NumericVector x, NumericVector y, bool concave);
+RcppExport SEXP _rcppassignment_convex_minorant(SEXP xSEXP, SEXP ySEXP, SEXP concaveSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< bool >::type concave(concaveSEXP);
+    rcpp_result_gen = Rcpp::wrap(convex_minorant(x, y, concave));
+    return rcpp_result_gen;
+END_RCPP
+}
+// convex_minorant_grouped
+List convex_minorant_grouped(NumericVector x, NumericVector y, IntegerVector group, bool concave);
+RcppExport SEXP _rcppassignment_convex_minorant_grouped(SEXP xSEXP, SEXP ySEXP, SEXP groupSEXP, SEXP concaveSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type group(groupSEXP);
+    Rcpp::traits::input_parameter< bool >::type concave(concaveSEXP);
+    rcpp_result_gen = Rcpp::wrap(convex_minorant_grouped(x, y, group, concave));
+    return rcpp_result_gen;
+END_RCPP
+}
+// dynamic_hull_create
+XPtr<dynamic_hull> dynamic_hull_create(NumericVector x, NumericVector y);
+RcppExport SEXP _rcppassignment_dynamic_hull_create(SEXP xSEXP, SEXP ySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    rcpp_result_gen = Rcpp::wrap(dynamic_hull_create(x, y));
+    return rcpp_result_gen;
+END_RCPP
+}
+// dynamic_hull_update
+void dynamic_hull_update(XPtr<dynamic_hull> hull, NumericVector x, NumericVector y, IntegerVector inserted, IntegerVector deleted, IntegerVector modified);
+RcppExport SEXP _rcppassignment_dynamic_hull_update(SEXP hullSEXP, SEXP xSEXP, SEXP ySEXP, SEXP insertedSEXP, SEXP deletedSEXP, SEXP modifiedSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< XPtr<dynamic_hull> >::type hull(hullSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type inserted(insertedSEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type deleted(deletedSEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type modified(modifiedSEXP);
+    dynamic_hull_update(hull, x, y, inserted, deleted, modified);
+    return R_NilValue;
+END_RCPP
+}
+// dynamic_hull_vertices
+IntegerVector dynamic_hull_vertices(XPtr<dynamic_hull> hull);
+RcppExport SEXP _rcppassignment_dynamic_hull_vertices(SEXP hullSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< XPtr<dynamic_hull> >::type hull(hullSEXP);
+    rcpp_result_gen = Rcpp::wrap(dynamic_hull_vertices(hull));
+    return rcpp_result_gen;
+END_RCPP
+}
+// enclosing_polygons
+List enclosing_polygons(NumericVector x, NumericVector y, IntegerVector group, int k);
+RcppExport SEXP _rcppassignment_enclosing_polygons(SEXP xSEXP, SEXP ySEXP, SEXP groupSEXP, SEXP kSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type group(groupSEXP);
+    Rcpp::traits::input_parameter< int >::type k(kSEXP);
+    rcpp_result_gen = Rcpp::wrap(enclosing_polygons(x, y, group, k));
+    return rcpp_result_gen;
+END_RCPP
+}
+// half_plane_intersection
+List half_plane_intersection(NumericVector a, NumericVector b, NumericVector c, double bound);
+RcppExport SEXP _rcppassignment_half_plane_intersection(SEXP aSEXP, SEXP bSEXP, SEXP cSEXP, SEXP boundSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type a(aSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type b(bSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type c(cSEXP);
+    Rcpp::traits::input_parameter< double >::type bound(boundSEXP);
+    rcpp_result_gen = Rcpp::wrap(half_plane_intersection(a, b, c, bound));
+    return rcpp_result_gen;
+END_RCPP
+}
+// convex_hull_3d
+List convex_hull_3d(NumericMatrix points, bool store_facets);
+RcppExport SEXP _rcppassignment_convex_hull_3d(SEXP pointsSEXP, SEXP store_facetsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericMatrix >::type points(pointsSEXP);
+    Rcpp::traits::input_parameter< bool >::type store_facets(store_facetsSEXP);
+    rcpp_result_gen = Rcpp::wrap(convex_hull_3d(points, store_facets));
+    return rcpp_result_gen;
+END_RCPP
+}
+// points_in_hull_3d
+LogicalVector points_in_hull_3d(NumericMatrix points, NumericMatrix query);
+RcppExport SEXP _rcppassignment_points_in_hull_3d(SEXP pointsSEXP, SEXP querySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericMatrix >::type points(pointsSEXP);
+    Rcpp::traits::input_parameter< NumericMatrix >::type query(querySEXP);
+    rcpp_result_gen = Rcpp::wrap(points_in_hull_3d(points, query));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hull_difference
+NumericVector hull_difference(NumericVector x1, NumericVector y1, NumericVector x2, NumericVector y2);
+RcppExport SEXP _rcppassignment_hull_difference(SEXP x1SEXP, SEXP y1SEXP, SEXP x2SEXP, SEXP y2SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x1(x1SEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y1(y1SEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type x2(x2SEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y2(y2SEXP);
+    rcpp_result_gen = Rcpp::wrap(hull_difference(x1, y1, x2, y2));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hull_difference_grouped
+List hull_difference_grouped(NumericVector x, NumericVector y, IntegerVector group);
+RcppExport SEXP _rcppassignment_hull_difference_grouped(SEXP xSEXP, SEXP ySEXP, SEXP groupSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type group(groupSEXP);
+    rcpp_result_gen = Rcpp::wrap(hull_difference_grouped(x, y, group));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hull_layers
+List hull_layers(NumericVector x, NumericVector y);
+RcppExport SEXP _rcppassignment_hull_layers(SEXP xSEXP, SEXP ySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    rcpp_result_gen = Rcpp::wrap(hull_layers(x, y));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hull_outlier_scores
+List hull_outlier_scores(NumericVector x, NumericVector y, int k);
+RcppExport SEXP _rcppassignment_hull_outlier_scores(SEXP xSEXP, SEXP ySEXP, SEXP kSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< int >::type k(kSEXP);
+    rcpp_result_gen = Rcpp::wrap(hull_outlier_scores(x, y, k));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hull_tangents
+List hull_tangents(NumericVector hx, NumericVector hy, NumericVector qx, NumericVector qy);
+RcppExport SEXP _rcppassignment_hull_tangents(SEXP hxSEXP, SEXP hySEXP, SEXP qxSEXP, SEXP qySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type hx(hxSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type hy(hySEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type qx(qxSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type qy(qySEXP);
+    rcpp_result_gen = Rcpp::wrap(hull_tangents(hx, hy, qx, qy));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hull_line_intersections
+List hull_line_intersections(NumericVector hx, NumericVector hy, NumericVector px, NumericVector py, NumericVector dx, NumericVector dy, bool ray);
+RcppExport SEXP _rcppassignment_hull_line_intersections(SEXP hxSEXP, SEXP hySEXP, SEXP pxSEXP, SEXP pySEXP, SEXP dxSEXP, SEXP dySEXP, SEXP raySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type hx(hxSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type hy(hySEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type px(pxSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type py(pySEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type dx(dxSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type dy(dySEXP);
+    Rcpp::traits::input_parameter< bool >::type ray(raySEXP);
+    rcpp_result_gen = Rcpp::wrap(hull_line_intersections(hx, hy, px, py, dx, dy, ray));
+    return rcpp_result_gen;
+END_RCPP
+}
+// points_in_hull
+LogicalVector points_in_hull(NumericVector hx, NumericVector hy, NumericVector x, NumericVector y);
+RcppExport SEXP _rcppassignment_points_in_hull(SEXP hxSEXP, SEXP hySEXP, SEXP xSEXP, SEXP ySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type hx(hxSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type hy(hySEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    rcpp_result_gen = Rcpp::wrap(points_in_hull(hx, hy, x, y));
+    return rcpp_result_gen;
+END_RCPP
+}
+// clip_polylines
+List clip_polylines(NumericVector hx, NumericVector hy, NumericVector x, NumericVector y, IntegerVector line);
+RcppExport SEXP _rcppassignment_clip_polylines(SEXP hxSEXP, SEXP hySEXP, SEXP xSEXP, SEXP ySEXP, SEXP lineSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type hx(hxSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type hy(hySEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type line(lineSEXP);
+    rcpp_result_gen = Rcpp::wrap(clip_polylines(hx, hy, x, y, line));
+    return rcpp_result_gen;
+END_RCPP
+}
+// triangulate_hull
+List triangulate_hull(NumericVector hx, NumericVector hy);
+RcppExport SEXP _rcppassignment_triangulate_hull(SEXP hxSEXP, SEXP hySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type hx(hxSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type hy(hySEXP);
+    rcpp_result_gen = Rcpp::wrap(triangulate_hull(hx, hy));
+    return rcpp_result_gen;
+END_RCPP
+}
+// sample_in_hull
+NumericMatrix sample_in_hull(NumericVector hx, NumericVector hy, int n);
+RcppExport SEXP _rcppassignment_sample_in_hull(SEXP hxSEXP, SEXP hySEXP, SEXP nSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type hx(hxSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type hy(hySEXP);
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    rcpp_result_gen = Rcpp::wrap(sample_in_hull(hx, hy, n));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hull_tracks
+List hull_tracks(IntegerVector object, NumericVector time, NumericVector x, NumericVector y);
+RcppExport SEXP _rcppassignment_hull_tracks(SEXP objectSEXP, SEXP timeSEXP, SEXP xSEXP, SEXP ySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< IntegerVector >::type object(objectSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type time(timeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    rcpp_result_gen = Rcpp::wrap(hull_tracks(object, time, x, y));
+    return rcpp_result_gen;
+END_RCPP
+}
+// inscribed_circles
+List inscribed_circles(NumericVector x, NumericVector y, IntegerVector group);
+RcppExport SEXP _rcppassignment_inscribed_circles(SEXP xSEXP, SEXP ySEXP, SEXP groupSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type group(groupSEXP);
+    rcpp_result_gen = Rcpp::wrap(inscribed_circles(x, y, group));
+    return rcpp_result_gen;
+END_RCPP
+}
+// jarvis_march
+std::vector<double> jarvis_march(std::vector<double> x, std::vector<double>& y, bool drop_non_finite);
+RcppExport SEXP _rcppassignment_jarvis_march(SEXP xSEXP, SEXP ySEXP, SEXP drop_non_finiteSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::vector<double> >::type x(xSEXP);
+    Rcpp::traits::input_parameter< std::vector<double>& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< bool >::type drop_non_finite(drop_non_finiteSEXP);
+    rcpp_result_gen = Rcpp::wrap(jarvis_march(x, y, drop_non_finite));
+    return rcpp_result_gen;
+END_RCPP
+}
+// lattice_hull
+List lattice_hull(IntegerVector x, IntegerVector y);
+RcppExport SEXP _rcppassignment_lattice_hull(SEXP xSEXP, SEXP ySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< IntegerVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type y(ySEXP);
+    rcpp_result_gen = Rcpp::wrap(lattice_hull(x, y));
+    return rcpp_result_gen;
+END_RCPP
+}
+// line_envelope_create
+XPtr<line_envelope> line_envelope_create();
+RcppExport SEXP _rcppassignment_line_envelope_create() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(line_envelope_create());
+    return rcpp_result_gen;
+END_RCPP
+}
+// line_envelope_add
+void line_envelope_add(XPtr<line_envelope> envelope, NumericVector slope, NumericVector intercept);
+RcppExport SEXP _rcppassignment_line_envelope_add(SEXP envelopeSEXP, SEXP slopeSEXP, SEXP interceptSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< XPtr<line_envelope> >::type envelope(envelopeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type slope(slopeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type intercept(interceptSEXP);
+    line_envelope_add(envelope, slope, intercept);
+    return R_NilValue;
+END_RCPP
+}
+// line_envelope_query
+NumericVector line_envelope_query(XPtr<line_envelope> envelope, NumericVector x);
+RcppExport SEXP _rcppassignment_line_envelope_query(SEXP envelopeSEXP, SEXP xSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< XPtr<line_envelope> >::type envelope(envelopeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    rcpp_result_gen = Rcpp::wrap(line_envelope_query(envelope, x));
+    return rcpp_result_gen;
+END_RCPP
+}
+// li_chao_create
+XPtr<li_chao_tree> li_chao_create(double lower, double upper);
+RcppExport SEXP _rcppassignment_li_chao_create(SEXP lowerSEXP, SEXP upperSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< double >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< double >::type upper(upperSEXP);
+    rcpp_result_gen = Rcpp::wrap(li_chao_create(lower, upper));
+    return rcpp_result_gen;
+END_RCPP
+}
+// li_chao_add
+void li_chao_add(XPtr<li_chao_tree> tree, NumericVector slope, NumericVector intercept);
+RcppExport SEXP _rcppassignment_li_chao_add(SEXP treeSEXP, SEXP slopeSEXP, SEXP interceptSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< XPtr<li_chao_tree> >::type tree(treeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type slope(slopeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type intercept(interceptSEXP);
+    li_chao_add(tree, slope, intercept);
+    return R_NilValue;
+END_RCPP
+}
+// li_chao_query
+NumericVector li_chao_query(XPtr<li_chao_tree> tree, NumericVector x);
+RcppExport SEXP _rcppassignment_li_chao_query(SEXP treeSEXP, SEXP xSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< XPtr<li_chao_tree> >::type tree(treeSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    rcpp_result_gen = Rcpp::wrap(li_chao_query(tree, x));
+    return rcpp_result_gen;
+END_RCPP
+}
+// convex_hull
+IntegerVector convex_hull(NumericVector x, NumericVector y, std::string chain);
+RcppExport SEXP _rcppassignment_convex_hull(SEXP xSEXP, SEXP ySEXP, SEXP chainSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< std::string >::type chain(chainSEXP);
+    rcpp_result_gen = Rcpp::wrap(convex_hull(x, y, chain));
+    return rcpp_result_gen;
+END_RCPP
+}
+// quickhull
+List quickhull(NumericMatrix points);
+RcppExport SEXP _rcppassignment_quickhull(SEXP pointsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericMatrix >::type points(pointsSEXP);
+    rcpp_result_gen = Rcpp::wrap(quickhull(points));
+    return rcpp_result_gen;
+END_RCPP
+}
+// skyline
+IntegerVector skyline(NumericVector x, NumericVector y, bool maximise_x, bool maximise_y);
+RcppExport SEXP _rcppassignment_skyline(SEXP xSEXP, SEXP ySEXP, SEXP maximise_xSEXP, SEXP maximise_ySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< bool >::type maximise_x(maximise_xSEXP);
+    Rcpp::traits::input_parameter< bool >::type maximise_y(maximise_ySEXP);
+    rcpp_result_gen = Rcpp::wrap(skyline(x, y, maximise_x, maximise_y));
+    return rcpp_result_gen;
+END_RCPP
+}
+// skyline_grouped
+List skyline_grouped(NumericVector x, NumericVector y, IntegerVector group, bool maximise_x, bool maximise_y);
+RcppExport SEXP _rcppassignment_skyline_grouped(SEXP xSEXP, SEXP ySEXP, SEXP groupSEXP, SEXP maximise_xSEXP, SEXP maximise_ySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< IntegerVector >::type group(groupSEXP);
+    Rcpp::traits::input_parameter< bool >::type maximise_x(maximise_xSEXP);
+    Rcpp::traits::input_parameter< bool >::type maximise_y(maximise_ySEXP);
+    rcpp_result_gen = Rcpp::wrap(skyline_grouped(x, y, group, maximise_x, maximise_y));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hulls_to_wkb
+List hulls_to_wkb(NumericVector x, NumericVector y, Nullable<IntegerVector> group);
+RcppExport SEXP _rcppassignment_hulls_to_wkb(SEXP xSEXP, SEXP ySEXP, SEXP groupSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< Nullable<IntegerVector> >::type group(groupSEXP);
+    rcpp_result_gen = Rcpp::wrap(hulls_to_wkb(x, y, group));
+    return rcpp_result_gen;
+END_RCPP
+}
+// hulls_to_wkt
+CharacterVector hulls_to_wkt(NumericVector x, NumericVector y, Nullable<IntegerVector> group);
+RcppExport SEXP _rcppassignment_hulls_to_wkt(SEXP xSEXP, SEXP ySEXP, SEXP groupSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< Nullable<IntegerVector> >::type group(groupSEXP);
+    rcpp_result_gen = Rcpp::wrap(hulls_to_wkt(x, y, group));
+    return rcpp_result_gen;
+END_RCPP
+}
+// write_hulls
+void write_hulls(NumericVector x, NumericVector y, std::string file, Nullable<IntegerVector> group, std::string format);
+RcppExport SEXP _rcppassignment_write_hulls(SEXP xSEXP, SEXP ySEXP, SEXP fileSEXP, SEXP groupSEXP, SEXP formatSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< NumericVector >::type x(xSEXP);
+    Rcpp::traits::input_parameter< NumericVector >::type y(ySEXP);
+    Rcpp::traits::input_parameter< std::string >::type file(fileSEXP);
+    Rcpp::traits::input_parameter< Nullable<IntegerVector> >::type group(groupSEXP);
+    Rcpp::traits::input_parameter< std::string >::type format(formatSEXP);
+    write_hulls(x, y, file, group, format);
+    return R_NilValue;
+END_RCPP
+}
 
 static const R_CallMethodDef CallEntries[] = {
-    {"_rcppassignment_dotproduct", (DL_FUNC) &_rcppassignment_dotproduct, 2},
+    {"_rcppassignment_bootstrap_hulls", (DL_FUNC) &_rcppassignment_bootstrap_hulls, 3},
+    {"_rcppassignment_convex_minorant", (DL_FUNC) &_rcppassignment_convex_minorant, 3},
+    {"_rcppassignment_convex_minorant_grouped", (DL_FUNC) &_rcppassignment_convex_minorant_grouped, 4},
+    {"_rcppassignment_dynamic_hull_create", (DL_FUNC) &_rcppassignment_dynamic_hull_create, 2},
+    {"_rcppassignment_dynamic_hull_update", (DL_FUNC) &_rcppassignment_dynamic_hull_update, 6},
+    {"_rcppassignment_dynamic_hull_vertices", (DL_FUNC) &_rcppassignment_dynamic_hull_vertices, 1},
+    {"_rcppassignment_enclosing_polygons", (DL_FUNC) &_rcppassignment_enclosing_polygons, 4},
+    {"_rcppassignment_half_plane_intersection", (DL_FUNC) &_rcppassignment_half_plane_intersection, 4},
+    {"_rcppassignment_convex_hull_3d", (DL_FUNC) &_rcppassignment_convex_hull_3d, 2},
+    {"_rcppassignment_points_in_hull_3d", (DL_FUNC) &_rcppassignment_points_in_hull_3d, 2},
+    {"_rcppassignment_hull_difference", (DL_FUNC) &_rcppassignment_hull_difference, 4},
+    {"_rcppassignment_hull_difference_grouped", (DL_FUNC) &_rcppassignment_hull_difference_grouped, 3},
+    {"_rcppassignment_hull_layers", (DL_FUNC) &_rcppassignment_hull_layers, 2},
+    {"_rcppassignment_hull_outlier_scores", (DL_FUNC) &_rcppassignment_hull_outlier_scores, 3},
+    {"_rcppassignment_hull_tangents", (DL_FUNC) &_rcppassignment_hull_tangents, 4},
+    {"_rcppassignment_hull_line_intersections", (DL_FUNC) &_rcppassignment_hull_line_intersections, 7},
+    {"_rcppassignment_points_in_hull", (DL_FUNC) &_rcppassignment_points_in_hull, 4},
+    {"_rcppassignment_clip_polylines", (DL_FUNC) &_rcppassignment_clip_polylines, 5},
+    {"_rcppassignment_triangulate_hull", (DL_FUNC) &_rcppassignment_triangulate_hull, 2},
+    {"_rcppassignment_sample_in_hull", (DL_FUNC) &_rcppassignment_sample_in_hull, 3},
+    {"_rcppassignment_hull_tracks", (DL_FUNC) &_rcppassignment_hull_tracks, 4},
+    {"_rcppassignment_inscribed_circles", (DL_FUNC) &_rcppassignment_inscribed_circles, 3},
+    {"_rcppassignment_jarvis_march", (DL_FUNC) &_rcppassignment_jarvis_march, 3},
+    {"_rcppassignment_lattice_hull", (DL_FUNC) &_rcppassignment_lattice_hull, 2},
+    {"_rcppassignment_line_envelope_create", (DL_FUNC) &_rcppassignment_line_envelope_create, 0},
+    {"_rcppassignment_line_envelope_add", (DL_FUNC) &_rcppassignment_line_envelope_add, 3},
+    {"_rcppassignment_line_envelope_query", (DL_FUNC) &_rcppassignment_line_envelope_query, 2},
+    {"_rcppassignment_li_chao_create", (DL_FUNC) &_rcppassignment_li_chao_create, 2},
+    {"_rcppassignment_li_chao_add", (DL_FUNC) &_rcppassignment_li_chao_add, 3},
+    {"_rcppassignment_li_chao_query", (DL_FUNC) &_rcppassignment_li_chao_query, 2},
+    {"_rcppassignment_convex_hull", (DL_FUNC) &_rcppassignment_convex_hull, 3},
+    {"_rcppassignment_quickhull", (DL_FUNC) &_rcppassignment_quickhull, 1},
+    {"_rcppassignment_skyline", (DL_FUNC) &_rcppassignment_skyline, 4},
+    {"_rcppassignment_skyline_grouped", (DL_FUNC) &_rcppassignment_skyline_grouped, 5},
+    {"_rcppassignment_hulls_to_wkb", (DL_FUNC) &_rcppassignment_hulls_to_wkb, 3},
+    {"_rcppassignment_hulls_to_wkt", (DL_FUNC) &_rcppassignment_hulls_to_wkt, 3},
+    {"_rcppassignment_write_hulls", (DL_FUNC) &_rcppassignment_write_hulls, 5},
     {NULL, NULL, 0}
 };
 
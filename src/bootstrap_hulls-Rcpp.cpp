@@ -0,0 +1,84 @@
+#include <vector>
+#include <cstdint>
+
+#include "monotone_chain.h"
+#include "random.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+List bootstrap_hulls(NumericVector x, NumericVector y, int replicates)
+/*
+Find the convex hulls of bootstrap resamples of a point set (for R package build).
+The points are sorted once. A resample only changes how many times each point is drawn, and a hull ...
+... depends only on which points are present, so each hull is one monotone chain pass over the shared ...
+... sorted order. Replicates are computed in parallel, each from its own random stream seeded from R, ...
+... so results follow set.seed whatever the number of threads.
+
+Parameters
+----------
+x : NumericVector
+    x coords
+y : NumericVector
+    y coords
+replicates : int
+    number of bootstrap resamples
+
+Returns
+-------
+hulls : List
+    replicate : IntegerVector
+        resample each hull vertex belongs to, numbered from 1
+    index : IntegerVector
+        position of each hull vertex in x, y (1-based), counterclockwise within each resample
+    area : NumericVector
+        area of the hull of each resample
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n)
+    {
+        stop("x and y must have the same length");
+    }
+    if (replicates < 0)
+    {
+        stop("replicates must not be negative");
+    }
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    std::vector<int> order {sort_points(px, py, n)};
+    uint64_t seed {(uint64_t) (R::unif_rand() * 4294967296.0) << 32 | (uint64_t) (R::unif_rand() * 4294967296.0)};
+
+    std::vector<std::vector<int> > hulls (replicates);
+    std::vector<double> areas (replicates);
+    #pragma omp parallel for schedule(dynamic)
+    for (int b = 0; b < replicates; b++)
+    {
+        random_stream stream(seed, b);
+        std::vector<char> drawn (n, 0);
+        for (int i = 0; i < n; i++)
+        {
+            drawn[(int) (stream.uniform() * n)] = 1;
+        }
+        hulls[b] = monotone_chain(px, py, order, drawn);
+        areas[b] = hull_area(px, py, hulls[b]);
+    }
+
+    // output
+    std::vector<int> replicate {};
+    std::vector<int> index {};
+    for (int b = 0; b < replicates; b++)
+    {
+        for (int v : hulls[b])
+        {
+            replicate.push_back(b + 1);
+            index.push_back(v + 1);
+        }
+    }
+    return List::create(Named("replicate") = replicate,
+                        Named("index") = index,
+                        Named("area") = areas);
+}
@@ -0,0 +1,169 @@
+#ifndef CANONICAL_HULL_H
+#define CANONICAL_HULL_H
+
+#include <vector>
+#include <algorithm>
+
+/*
+The canonical form of a two-dimensional hull, shared by every engine:
+    - vertices run counterclockwise
+    - the first vertex is the leftmost point, taking the lowest of these if there are ties
+    - repeated vertices are removed
+    - points in the interior of a hull edge are removed, unless keep_collinear is set
+    - if every point is collinear the hull is the two end points (or every point, in ...
+      ... lexicographic order, with keep_collinear)
+
+These helpers work with any point type with x and y members, given an overload ...
+... orientation(p1, p2, p3) returning +1, -1 or 0 as in geometry.h.
+*/
+
+template <typename P>
+bool lexicographically_less(const P& a, const P& b)
+/*
+Order points by x-coordinate, then by y-coordinate
+
+Parameters
+----------
+a, b : P
+    points to compare
+
+Returns
+-------
+less : bool
+    True if a comes before b
+*/
+
+{
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+template <typename P>
+bool is_canonical_hull(const std::vector<P>& hull)
+/*
+Test whether the vertices of a convex hull are already in canonical form (without collinear points), in O(h).
+Every turn around the ring must be strictly counterclockwise, and so must every turn seen from the start ...
+... vertex, which rules out a ring winding round more than once.
+
+Parameters
+----------
+hull : vector<P>
+    vertices of a convex hull
+
+Returns
+-------
+canonical : bool
+*/
+
+{
+    int h {(int) hull.size()};
+    if (h < 3)
+    {
+        return h < 2 || lexicographically_less(hull[0], hull[1]);
+    }
+    for (int i = 1; i < h; i++)
+    {
+        // orientation counts a repeated point as a left turn, so repeats are looked for separately
+        bool repeated {hull[i].x == hull[i - 1].x && hull[i].y == hull[i - 1].y};
+        if (repeated || !lexicographically_less(hull[0], hull[i]) || orientation(hull[i - 1], hull[i], hull[(i + 1) % h]) <= 0)
+        {
+            return false;
+        }
+    }
+    if (orientation(hull[h - 1], hull[0], hull[1]) <= 0)
+    {
+        return false;
+    }
+    for (int i = 2; i < h; i++)
+    {
+        if (orientation(hull[0], hull[i - 1], hull[i]) <= 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename P>
+std::vector<P> canonicalise_hull(const std::vector<P>& hull, bool keep_collinear = false)
+/*
+Put the vertices of a convex hull into canonical form.
+The result depends only on the set of vertices given, not their order: they are sorted by angle ...
+... around the start vertex and passed once through a Graham scan, which costs O(h log h) for h vertices.
+The scan also discards any repeated or non-convex vertices an engine may have emitted.
+
+Parameters
+----------
+hull : vector<P>
+    vertices of a convex hull in any order
+keep_collinear : bool
+    keep points lying in the interior of hull edges
+
+Returns
+-------
+canonical_hull : vector<P>
+    the same hull in canonical form
+*/
+
+{
+    // drop repeated vertices; the first is then the start vertex
+    std::vector<P> ring (hull);
+    std::sort(ring.begin(), ring.end(), lexicographically_less<P>);
+    ring.erase(std::unique(ring.begin(), ring.end(), [](const P& a, const P& b)
+    {
+        return a.x == b.x && a.y == b.y;
+    }), ring.end());
+    int h {(int) ring.size()};
+    if (h < 3)
+    {
+        return ring;
+    }
+
+    /* every other vertex lies in the half-plane to the right of (or above) the start vertex, so turning ...
+    ... direction gives a consistent angular order, and ties along a ray are ordered by distance */
+    const P start {ring[0]};
+    std::sort(ring.begin() + 1, ring.end(), [&start](const P& a, const P& b)
+    {
+        int turn {orientation(start, a, b)};
+        return turn != 0 ? turn > 0 : lexicographically_less(a, b);
+    });
+
+    // every point collinear
+    if (orientation(start, ring[1], ring.back()) == 0)
+    {
+        if (keep_collinear == false)
+        {
+            ring.erase(ring.begin() + 1, ring.end() - 1);
+        }
+        return ring;
+    }
+
+    // kept points on the closing edge back to the start are visited furthest first
+    if (keep_collinear == true)
+    {
+        int closing {h - 1};
+        while (closing > 1 && orientation(start, ring[closing - 1], ring.back()) == 0)
+        {
+            closing--;
+        }
+        std::reverse(ring.begin() + closing, ring.end());
+    }
+
+    // Graham scan, popping straight turns unless collinear points are kept
+    std::vector<P> canonical_hull {};
+    for (const P& p : ring)
+    {
+        while (canonical_hull.size() >= 2)
+        {
+            int turn {orientation(canonical_hull[canonical_hull.size() - 2], canonical_hull.back(), p)};
+            if (turn > 0 || (turn == 0 && keep_collinear == true))
+            {
+                break;
+            }
+            canonical_hull.pop_back();
+        }
+        canonical_hull.push_back(p);
+    }
+    return canonical_hull;
+}
+
+#endif
@@ -0,0 +1,170 @@
+#include <vector>
+
+#include "monotone_chain.h"
+#include "groups.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+void fit_minorant(const double* x, const double* y, int n, bool concave, double* value, int* knot)
+/*
+Finds the greatest convex minorant of a series, or its least concave majorant, and evaluates it at every point.
+The minorant is the lower chain of the convex hull of the points and the majorant the upper chain, ...
+... built with the monotone chain on the orientation predicate; ordered series are not sorted again, so ...
+... the cost is O(n).
+
+Parameters
+----------
+x, y : const double*
+    the series
+n : int
+    length of the series
+concave : bool
+    find the least concave majorant rather than the greatest convex minorant
+value : double*
+    set to the value of the minorant at each x
+knot : int*
+    set to 1 for the points where the minorant bends or ends, 0 otherwise
+
+Returns
+-------
+None
+*/
+
+{
+    if (n == 0)
+    {
+        return;
+    }
+    std::vector<int> order {sort_points(x, y, n)};
+    std::vector<int> chain {monotone_half_chain(x, y, order, concave)};
+
+    // a chain with several points at its end x-coordinate keeps the lowest (or highest) of them
+    if (!concave)
+    {
+        while (chain.size() >= 2 && x[chain[chain.size() - 2]] == x[chain.back()])
+        {
+            chain.pop_back();
+        }
+    }
+    else
+    {
+        while (chain.size() >= 2 && x[chain[0]] == x[chain[1]])
+        {
+            chain.erase(chain.begin());
+        }
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        knot[i] = 0;
+    }
+    for (int i : chain)
+    {
+        knot[i] = 1;
+    }
+
+    // evaluate in sorted order, walking along the chain
+    int k {0};
+    int last {(int) chain.size() - 1};
+    for (int i : order)
+    {
+        while (k < last && x[chain[k + 1]] <= x[i])
+        {
+            k++;
+        }
+        if (k == last || x[chain[k]] == x[i])
+        {
+            value[i] = y[chain[k]];
+        }
+        else
+        {
+            double t {(x[i] - x[chain[k]]) / (x[chain[k + 1]] - x[chain[k]])};
+            value[i] = y[chain[k]] + t * (y[chain[k + 1]] - y[chain[k]]);
+        }
+    }
+}
+
+// [[Rcpp::export]]
+List convex_minorant(NumericVector x, NumericVector y, bool concave = false)
+/*
+Find the greatest convex minorant, or least concave majorant, of a series (for R package build).
+
+Parameters
+----------
+x : NumericVector
+    x coords, in O(n) if in increasing order
+y : NumericVector
+    y coords
+concave : bool
+    find the least concave majorant rather than the greatest convex minorant
+
+Returns
+-------
+minorant : List
+    value : NumericVector
+        value of the minorant at each x
+    knot : LogicalVector
+        True for the points where the minorant bends or ends
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n)
+    {
+        stop("x and y must have the same length");
+    }
+    NumericVector value(n);
+    LogicalVector knot(n);
+    fit_minorant(x.begin(), y.begin(), n, concave, value.begin(), knot.begin());
+    return List::create(Named("value") = value,
+                        Named("knot") = knot);
+}
+
+// [[Rcpp::export]]
+List convex_minorant_grouped(NumericVector x, NumericVector y, IntegerVector group, bool concave = false)
+/*
+Find the greatest convex minorant, or least concave majorant, of many series in parallel (for R package build).
+
+Parameters
+----------
+x, y : NumericVector
+    the series
+group : IntegerVector
+    series of each point; the points of each series must be in consecutive rows
+concave : bool
+    find least concave majorants rather than greatest convex minorants
+
+Returns
+-------
+minorants : List
+    value : NumericVector
+        value of the minorant of its series at each x
+    knot : LogicalVector
+        True for the points where the minorant of their series bends or ends
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n || group.size() != n)
+    {
+        stop("x, y and group must have the same length");
+    }
+    std::vector<int> starts {find_group_starts(group.begin(), n)};
+    int n_groups {(int) starts.size() - 1};
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    NumericVector value(n);
+    LogicalVector knot(n);
+    double* value_out {value.begin()};
+    int* knot_out {knot.begin()};
+    #pragma omp parallel for schedule(dynamic)
+    for (int g = 0; g < n_groups; g++)
+    {
+        int start {starts[g]};
+        fit_minorant(px + start, py + start, starts[g + 1] - start, concave, value_out + start, knot_out + start);
+    }
+    return List::create(Named("value") = value,
+                        Named("knot") = knot);
+}
@@ -0,0 +1,1144 @@
+#ifndef CONVEX_POLYGON_H
+#define CONVEX_POLYGON_H
+
+#include <vector>
+#include <deque>
+#include <queue>
+#include <iterator>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+#include "geometry.h"
+#include "canonical_hull.h"
+
+inline double cross_product(double ox, double oy, double ax, double ay, double bx, double by)
+/*
+Cross product of (a - o) and (b - o). Positive when o -> a -> b turns left (counterclockwise).
+
+Parameters
+----------
+ox, oy, ax, ay, bx, by : double
+    coordinates of the points o, a and b
+
+Returns
+-------
+cross : double
+*/
+
+{
+    return (ax - ox) * (by - oy) - (ay - oy) * (bx - ox);
+}
+
+inline double segment_distance(double px, double py, double ax, double ay, double bx, double by)
+/*
+Distance from point p to the segment from a to b
+
+Parameters
+----------
+px, py, ax, ay, bx, by : double
+    coordinates of p and the segment end points
+
+Returns
+-------
+distance : double
+*/
+
+{
+    double dx {bx - ax};
+    double dy {by - ay};
+    double length_squared {dx * dx + dy * dy};
+    double t {length_squared > 0 ? ((px - ax) * dx + (py - ay) * dy) / length_squared : 0};
+    t = std::min(1.0, std::max(0.0, t));
+    return std::hypot(px - (ax + t * dx), py - (ay + t * dy));
+}
+
+struct polygon_vertex : point
+/*
+A structure to represent a vertex of a polygon, remembering its position in the input
+
+Attributes
+----------
+index : int
+    position of the vertex in the input
+
+Methods
+-------
+None
+*/
+{
+    int index;
+
+    polygon_vertex(double _x, double _y, int _index) : point(_x, _y)
+    {
+        index = _index;
+    }
+};
+
+struct convex_polygon
+/*
+A structure to represent a convex hull as a polygon in canonical form (see canonical_hull.h), ...
+... with coordinates held in separate arrays, supporting logarithmic-time queries.
+
+Attributes
+----------
+x : vector<double>
+    x-coordinates of the vertices, counterclockwise
+y : vector<double>
+    y-coordinates of the vertices, counterclockwise
+index : vector<int>
+    position of each vertex in the input it was read from
+
+Methods
+-------
+size:
+    number of vertices
+area:
+    area enclosed
+contains:
+    tests whether a point lies inside or on the polygon, in O(log h)
+distance:
+    distance from a point to the polygon, in O(log h + k) for a visible chain of k edges
+extreme_vertex:
+    vertex furthest in a given direction, in O(log h)
+tangents:
+    vertices touched by the two tangents from an external point, in O(log h)
+line_intersection:
+    interval of a line inside the polygon, in O(log h)
+inscribed_circle:
+    largest circle inside the polygon, in O(h log h)
+*/
+{
+    std::vector<double> x {};
+    std::vector<double> y {};
+    std::vector<int> index {};
+
+    convex_polygon()
+    /*
+    Initialise an empty polygon
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    None
+    */
+
+    {
+    }
+
+    convex_polygon(const std::vector<point>& hull)
+    /*
+    Initialise instance of the convex_polygon structure from the vertices of a hull in any order.
+    Hulls already in canonical form, such as those returned by the engines of this package, are checked and ...
+    ... taken as given in O(h). Other hulls are put into canonical form in O(h log h), which then dominates ...
+    ... the cost of linear-time operations such as intersect_polygons.
+
+    Parameters
+    ----------
+    hull : vector<point>
+        vertices of a convex hull
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        if (is_canonical_hull(hull))
+        {
+            for (int i = 0; i < (int) hull.size(); i++)
+            {
+                x.push_back(hull[i].x);
+                y.push_back(hull[i].y);
+                index.push_back(i);
+            }
+            return;
+        }
+        std::vector<polygon_vertex> vertices {};
+        for (int i = 0; i < (int) hull.size(); i++)
+        {
+            vertices.push_back(polygon_vertex(hull[i].x, hull[i].y, i));
+        }
+        for (const polygon_vertex& v : canonicalise_hull(vertices))
+        {
+            x.push_back(v.x);
+            y.push_back(v.y);
+            index.push_back(v.index);
+        }
+    }
+
+    int size() const
+    {
+        return (int) x.size();
+    }
+
+    double area() const
+    /*
+    Area enclosed by the polygon (shoelace formula)
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    area : double
+    */
+
+    {
+        int h {size()};
+        double twice_area {0};
+        for (int i = 0, j = h - 1; i < h; j = i++)
+        {
+            twice_area += x[j] * y[i] - x[i] * y[j];
+        }
+        return h < 3 ? 0.0 : twice_area / 2;
+    }
+
+    int find_wedge(double px, double py) const
+    /*
+    Locate a point among the wedges fanning out from vertex 0.
+    Wedge k is bounded by the rays from vertex 0 through vertices k and k+1.
+
+    Parameters
+    ----------
+    px, py : double
+        coordinates of the point
+
+    Returns
+    -------
+    wedge : int
+        k in 1, ..., h-2 if the point lies in wedge k, 0 if it lies to the right of the ray through vertex 1, ...
+        ... and h-1 if it lies to the left of the ray through vertex h-1
+    */
+
+    {
+        int h {size()};
+        if (cross_product(x[0], y[0], x[1], y[1], px, py) < 0)
+        {
+            return 0;
+        }
+        if (cross_product(x[0], y[0], x[h - 1], y[h - 1], px, py) > 0)
+        {
+            return h - 1;
+        }
+
+        // binary search for the last vertex not to the left of the point
+        int low {1};
+        int high {h - 1};
+        while (high - low > 1)
+        {
+            int middle {(low + high) / 2};
+            if (cross_product(x[0], y[0], x[middle], y[middle], px, py) >= 0)
+            {
+                low = middle;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        return low;
+    }
+
+    bool contains(double px, double py) const
+    /*
+    Test whether a point lies inside or on the polygon
+
+    Parameters
+    ----------
+    px, py : double
+        coordinates of the point
+
+    Returns
+    -------
+    inside : bool
+    */
+
+    {
+        int h {size()};
+        if (h < 3)
+        {
+            return distance(px, py) == 0;
+        }
+        int wedge {find_wedge(px, py)};
+        if (wedge == 0 || wedge == h - 1)
+        {
+            return false;
+        }
+        return cross_product(x[wedge], y[wedge], x[wedge + 1], y[wedge + 1], px, py) >= 0;
+    }
+
+    double distance(double px, double py) const
+    /*
+    Distance from a point to the polygon (zero if the point lies inside).
+    For a point outside, the nearest point lies on the chain of edges visible from it. ...
+    ... One visible edge is found from the wedge containing the point, then the chain is walked both ways.
+
+    Parameters
+    ----------
+    px, py : double
+        coordinates of the point
+
+    Returns
+    -------
+    distance : double
+    */
+
+    {
+        int h {size()};
+        if (h == 0)
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+        if (h == 1)
+        {
+            return std::hypot(px - x[0], py - y[0]);
+        }
+        if (h == 2)
+        {
+            return segment_distance(px, py, x[0], y[0], x[1], y[1]);
+        }
+
+        int edge {find_wedge(px, py)};
+        if (cross_product(x[edge], y[edge], x[(edge + 1) % h], y[(edge + 1) % h], px, py) >= 0)
+        {
+            return 0;
+        }
+
+        double nearest {segment_distance(px, py, x[edge], y[edge], x[(edge + 1) % h], y[(edge + 1) % h])};
+        for (int step = 1; step < h; step++)
+        {
+            int e {(edge + step) % h};
+            if (cross_product(x[e], y[e], x[(e + 1) % h], y[(e + 1) % h], px, py) >= 0)
+            {
+                break;
+            }
+            nearest = std::min(nearest, segment_distance(px, py, x[e], y[e], x[(e + 1) % h], y[(e + 1) % h]));
+        }
+        for (int step = 1; step < h; step++)
+        {
+            int e {(edge - step + h) % h};
+            if (cross_product(x[e], y[e], x[(e + 1) % h], y[(e + 1) % h], px, py) >= 0)
+            {
+                break;
+            }
+            nearest = std::min(nearest, segment_distance(px, py, x[e], y[e], x[(e + 1) % h], y[(e + 1) % h]));
+        }
+        return nearest;
+    }
+
+    int extreme_vertex(double ux, double uy) const
+    /*
+    Find the vertex furthest in direction u, i.e. maximising u . v.
+    Around the polygon u . v rises to a single maximum and falls to a single minimum, so the ...
+    ... maximum is found by bisection, comparing each probe with vertex 0 and the slope of the edge leaving it.
+
+    Parameters
+    ----------
+    ux, uy : double
+        the direction
+
+    Returns
+    -------
+    vertex : int
+        position of the extreme vertex, -1 if the polygon is empty
+    */
+
+    {
+        int h {size()};
+        if (h < 3)
+        {
+            int best {h > 0 ? 0 : -1};
+            for (int i = 1; i < h; i++)
+            {
+                if (ux * x[i] + uy * y[i] > ux * x[best] + uy * y[best])
+                {
+                    best = i;
+                }
+            }
+            return best;
+        }
+
+        auto height = [&](int i) { return ux * x[i % h] + uy * y[i % h]; };
+        auto rising = [&](int i) { return height(i + 1) > height(i); };
+
+        double base {height(0)};
+        bool rising_from_base {rising(0)};
+        if (!rising_from_base && height(h - 1) <= base)
+        {
+            return 0;
+        }
+
+        // the maximum lies in [low, high], taking vertex h as vertex 0
+        int low {0};
+        int high {h};
+        while (high - low > 1)
+        {
+            int middle {(low + high) / 2};
+            bool after_maximum {};
+            if (rising_from_base)
+            {
+                // rising from vertex 0 to the maximum, falling, then rising back below vertex 0
+                after_maximum = !rising(middle) || height(middle) < base;
+            }
+            else
+            {
+                // falling from vertex 0 to the minimum, rising to the maximum, then falling back above vertex 0
+                after_maximum = !rising(middle) && height(middle) > base;
+            }
+            if (after_maximum)
+            {
+                high = middle;
+            }
+            else
+            {
+                low = middle;
+            }
+        }
+        return height(high) > height(low) ? high % h : low % h;
+    }
+
+    bool edge_visible(int i, double px, double py) const
+    {
+        int h {size()};
+        return cross_product(x[i], y[i], x[(i + 1) % h], y[(i + 1) % h], px, py) < 0;
+    }
+
+    bool tangents(double px, double py, int& left, int& right) const
+    /*
+    Find the two tangents to the polygon from an external point.
+    The edges visible from the point form a single run [s, e]; the tangents touch vertices s and e+1. ...
+    ... A visible edge is found from the wedge containing the point and a hidden edge from the vertex ...
+    ... furthest away from the point, then both ends of the run are found by bisection between them.
+
+    Parameters
+    ----------
+    px, py : double
+        coordinates of the point
+    left : int&
+        set to the vertex s, with the polygon to the right of the ray from the point through it
+    right : int&
+        set to the vertex e+1, with the polygon to the left of the ray from the point through it
+
+    Returns
+    -------
+    outside : bool
+        False if the point lies inside or on the polygon, in which case there are no tangents
+    */
+
+    {
+        int h {size()};
+        if (h < 3)
+        {
+            return false;
+        }
+
+        int visible {find_wedge(px, py)};
+        if (!edge_visible(visible, px, py))
+        {
+            return false;
+        }
+
+        // one of the two edges at the vertex furthest from the point faces away from it
+        double cx {(x[0] + x[h / 3] + x[2 * h / 3]) / 3};
+        double cy {(y[0] + y[h / 3] + y[2 * h / 3]) / 3};
+        int hidden {extreme_vertex(cx - px, cy - py)};
+        if (edge_visible(hidden, px, py))
+        {
+            hidden = (hidden + h - 1) % h;
+        }
+
+        // last visible edge walking forwards from the visible edge
+        int low {0};
+        int high {(hidden - visible + h) % h};
+        while (high - low > 1)
+        {
+            int middle {(low + high) / 2};
+            if (edge_visible((visible + middle) % h, px, py))
+            {
+                low = middle;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        right = (visible + low + 1) % h;
+
+        // first visible edge walking backwards from the visible edge
+        low = 0;
+        high = (visible - hidden + h) % h;
+        while (high - low > 1)
+        {
+            int middle {(low + high) / 2};
+            if (edge_visible((visible - middle + h) % h, px, py))
+            {
+                low = middle;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        left = (visible - low + h) % h;
+        return true;
+    }
+
+    bool line_intersection(double px, double py, double dx, double dy, double& t_enter, double& t_exit) const
+    /*
+    Find where the line p + t d crosses the polygon.
+    With n normal to d, the support function gives the vertices maximising and minimising n . (v - p); ...
+    ... the line misses unless these lie on either side of it. Between them n . (v - p) is monotone along ...
+    ... each chain of the polygon, so the crossing edge of each chain is found by bisection.
+
+    Parameters
+    ----------
+    px, py : double
+        a point on the line
+    dx, dy : double
+        direction of the line
+    t_enter, t_exit : double&
+        set to the smallest and largest t for which p + t d lies in the polygon
+
+    Returns
+    -------
+    hit : bool
+        False if the line misses the polygon
+    */
+
+    {
+        int h {size()};
+        double nx {-dy};
+        double ny {dx};
+        double length_squared {dx * dx + dy * dy};
+        if (h == 0 || length_squared == 0)
+        {
+            return false;
+        }
+        auto side = [&](int i) { return nx * (x[i % h] - px) + ny * (y[i % h] - py); };
+        auto parameter = [&](double qx, double qy) { return (dx * (qx - px) + dy * (qy - py)) / length_squared; };
+
+        int top {extreme_vertex(nx, ny)};
+        int bottom {extreme_vertex(-nx, -ny)};
+        if (side(top) < 0 || side(bottom) > 0)
+        {
+            return false;
+        }
+
+        // the line only touches the polygon, along an edge or at a vertex
+        if (side(bottom) == 0 || side(top) == 0)
+        {
+            int touching {side(bottom) == 0 ? bottom : top};
+            t_enter = parameter(x[touching], y[touching]);
+            t_exit = t_enter;
+            for (int neighbour : {touching + h - 1, touching + 1})
+            {
+                if (side(neighbour) == 0)
+                {
+                    double t {parameter(x[neighbour % h], y[neighbour % h])};
+                    t_enter = std::min(t_enter, t);
+                    t_exit = std::max(t_exit, t);
+                }
+            }
+            return true;
+        }
+
+        // where a chain crosses the line, between vertex i on or above it and vertex j below (or the reverse)
+        auto crossing = [&](int i, int j)
+        {
+            double fi {side(i)};
+            double fj {side(j)};
+            double s {fi == fj ? 0 : fi / (fi - fj)};
+            return parameter(x[i % h] + s * (x[j % h] - x[i % h]), y[i % h] + s * (y[j % h] - y[i % h]));
+        };
+
+        // chain from top to bottom, where side falls: last vertex on or above the line
+        int length {(bottom - top + h) % h};
+        int low {0};
+        int high {length};
+        while (high - low > 1)
+        {
+            int middle {(low + high) / 2};
+            if (side(top + middle) >= 0)
+            {
+                low = middle;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        double t_first {crossing(top + low, top + low + 1)};
+
+        // chain from bottom to top, where side rises: first vertex on or above the line
+        length = (top - bottom + h) % h;
+        low = 0;
+        high = length;
+        while (high - low > 1)
+        {
+            int middle {(low + high) / 2};
+            if (side(bottom + middle) >= 0)
+            {
+                high = middle;
+            }
+            else
+            {
+                low = middle;
+            }
+        }
+        double t_second {crossing(bottom + high, bottom + high - 1)};
+
+        t_enter = std::min(t_first, t_second);
+        t_exit = std::max(t_first, t_second);
+        return true;
+    }
+
+    double inscribed_circle(double& cx, double& cy) const
+    /*
+    Find the largest circle inside the polygon, by shrinking the polygon until it collapses.
+    Every edge moves inwards at unit speed, so an edge vanishes when the lines of it and its two ...
+    ... neighbours meet at one point. Edges are removed in order of vanishing time from a heap, ...
+    ... and when three remain their common point is the centre of the circle.
+
+    Parameters
+    ----------
+    cx, cy : double&
+        set to the coordinates of the centre
+
+    Returns
+    -------
+    radius : double
+        radius of the circle, 0 for polygons with fewer than three vertices
+    */
+
+    {
+        int h {size()};
+        if (h < 3)
+        {
+            cx = 0;
+            cy = 0;
+            for (int i = 0; i < h; i++)
+            {
+                cx += x[i] / h;
+                cy += y[i] / h;
+            }
+            return 0;
+        }
+
+        // unit outward normal and offset of each edge, so the polygon is nx x + ny y <= offset
+        std::vector<double> nx (h);
+        std::vector<double> ny (h);
+        std::vector<double> offset (h);
+        for (int i = 0; i < h; i++)
+        {
+            int j {(i + 1) % h};
+            double length {std::hypot(x[j] - x[i], y[j] - y[i])};
+            nx[i] = (y[j] - y[i]) / length;
+            ny[i] = (x[i] - x[j]) / length;
+            offset[i] = nx[i] * x[i] + ny[i] * y[i];
+        }
+
+        // the point at distance t inside edges a, b and c: n . p + t = offset for each
+        auto meet = [&nx, &ny, &offset](int a, int b, int c, double& px, double& py)
+        {
+            double determinent {nx[a] * (ny[b] - ny[c]) - ny[a] * (nx[b] - nx[c]) + (nx[b] * ny[c] - nx[c] * ny[b])};
+            if (determinent <= 0)
+            {
+                return std::numeric_limits<double>::infinity();
+            }
+            px = (offset[a] * (ny[b] - ny[c]) - ny[a] * (offset[b] - offset[c]) + (offset[b] * ny[c] - offset[c] * ny[b])) / determinent;
+            py = (nx[a] * (offset[b] - offset[c]) - offset[a] * (nx[b] - nx[c]) + (nx[b] * offset[c] - nx[c] * offset[b])) / determinent;
+            return offset[a] - nx[a] * px - ny[a] * py;
+        };
+
+        std::vector<int> previous (h);
+        std::vector<int> next (h);
+        std::vector<int> version (h, 0);
+        std::priority_queue<std::pair<double, std::pair<int, int> >, std::vector<std::pair<double, std::pair<int, int> > >,
+                            std::greater<std::pair<double, std::pair<int, int> > > > events {};
+        double px {};
+        double py {};
+        for (int i = 0; i < h; i++)
+        {
+            previous[i] = (i + h - 1) % h;
+            next[i] = (i + 1) % h;
+            events.push({meet(previous[i], i, next[i], px, py), {i, 0}});
+        }
+
+        int remaining {h};
+        while (remaining > 3)
+        {
+            int i {events.top().second.first};
+            int stamp {events.top().second.second};
+            events.pop();
+            if (stamp != version[i])
+            {
+                continue;
+            }
+            version[i] = -1;
+            next[previous[i]] = next[i];
+            previous[next[i]] = previous[i];
+            remaining--;
+            for (int j : {previous[i], next[i]})
+            {
+                version[j]++;
+                events.push({meet(previous[j], j, next[j], px, py), {j, version[j]}});
+            }
+        }
+
+        int last {0};
+        while (version[last] < 0)
+        {
+            last++;
+        }
+        double radius {meet(previous[last], last, next[last], cx, cy)};
+        return std::max(0.0, radius);
+    }
+};
+
+struct edge_planes
+/*
+A structure holding the edge half-planes of a convex polygon in structure-of-arrays layout, ...
+... so a point or segment is tested against every edge in a single vectorised loop.
+Edge i keeps the points with a[i] x + b[i] y <= c[i].
+
+Attributes
+----------
+a, b : vector<double>
+    outward normal of each edge
+c : vector<double>
+    offset of each edge
+lower_x, lower_y, upper_x, upper_y : double
+    bounding box of the polygon
+
+Methods
+-------
+contains:
+    tests whether a point lies inside or on the polygon
+clip_segment:
+    Cyrus-Beck clipping of a segment to the polygon
+*/
+{
+    std::vector<double> a {};
+    std::vector<double> b {};
+    std::vector<double> c {};
+    double lower_x {std::numeric_limits<double>::infinity()};
+    double lower_y {std::numeric_limits<double>::infinity()};
+    double upper_x {-std::numeric_limits<double>::infinity()};
+    double upper_y {-std::numeric_limits<double>::infinity()};
+
+    edge_planes(const convex_polygon& polygon)
+    /*
+    Initialise instance of the edge_planes structure
+
+    Parameters
+    ----------
+    polygon : convex_polygon
+        polygon with at least three vertices
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        int h {polygon.size()};
+        for (int i = 0; i < h; i++)
+        {
+            int j {(i + 1) % h};
+            a.push_back(polygon.y[j] - polygon.y[i]);
+            b.push_back(polygon.x[i] - polygon.x[j]);
+            c.push_back(a.back() * polygon.x[i] + b.back() * polygon.y[i]);
+            lower_x = std::min(lower_x, polygon.x[i]);
+            lower_y = std::min(lower_y, polygon.y[i]);
+            upper_x = std::max(upper_x, polygon.x[i]);
+            upper_y = std::max(upper_y, polygon.y[i]);
+        }
+    }
+
+    bool contains(double px, double py) const
+    /*
+    Test whether a point lies inside or on the polygon, after a bounding box check
+
+    Parameters
+    ----------
+    px, py : double
+        coordinates of the point
+
+    Returns
+    -------
+    inside : bool
+        false if a coordinate is NaN
+    */
+
+    {
+        // written so that NaN coordinates fail the bounding box check
+        if (!(px >= lower_x && px <= upper_x && py >= lower_y && py <= upper_y))
+        {
+            return false;
+        }
+        int h {(int) c.size()};
+        const double* pa {a.data()};
+        const double* pb {b.data()};
+        const double* pc {c.data()};
+        double furthest {-std::numeric_limits<double>::infinity()};
+        #pragma omp simd reduction(max:furthest)
+        for (int i = 0; i < h; i++)
+        {
+            furthest = std::max(furthest, pa[i] * px + pb[i] * py - pc[i]);
+        }
+        return furthest <= 0;
+    }
+
+    bool clip_segment(double x0, double y0, double x1, double y1, double& t_enter, double& t_exit) const
+    /*
+    Clip the segment from (x0, y0) to (x1, y1) to the polygon (Cyrus-Beck).
+    Edges facing against the segment raise the entry parameter and edges facing along it lower the exit parameter.
+
+    Parameters
+    ----------
+    x0, y0, x1, y1 : double
+        end points of the segment
+    t_enter, t_exit : double&
+        set so the clipped segment runs from parameter t_enter to t_exit, with 0 <= t_enter <= t_exit <= 1
+
+    Returns
+    -------
+    hit : bool
+        False if no part of the segment lies in the polygon
+    */
+
+    {
+        if (std::max(x0, x1) < lower_x || std::min(x0, x1) > upper_x || std::max(y0, y1) < lower_y || std::min(y0, y1) > upper_y)
+        {
+            return false;
+        }
+        int h {(int) c.size()};
+        const double* pa {a.data()};
+        const double* pb {b.data()};
+        const double* pc {c.data()};
+        double dx {x1 - x0};
+        double dy {y1 - y0};
+        double enter {0};
+        double exit {1};
+        int parallel_outside {0};
+        #pragma omp simd reduction(max:enter) reduction(min:exit) reduction(|:parallel_outside)
+        for (int i = 0; i < h; i++)
+        {
+            double along {pa[i] * dx + pb[i] * dy};
+            double room {pc[i] - pa[i] * x0 - pb[i] * y0};
+            double t {room / along};
+            enter = along < 0 ? std::max(enter, t) : enter;
+            exit = along > 0 ? std::min(exit, t) : exit;
+            parallel_outside |= (along == 0 && room < 0);
+        }
+        t_enter = enter;
+        t_exit = exit;
+        return parallel_outside == 0 && enter <= exit;
+    }
+};
+
+struct half_plane
+/*
+A structure to represent the closed half-plane to the left of a directed line
+
+Attributes
+----------
+px, py : double
+    a point on the line
+dx, dy : double
+    direction of the line
+angle : double
+    angle of the direction, used to order half-planes
+
+Methods
+-------
+outside:
+    tests whether a point lies strictly outside the half-plane
+*/
+{
+    double px;
+    double py;
+    double dx;
+    double dy;
+    double angle;
+
+    half_plane(double _px, double _py, double _dx, double _dy)
+    /*
+    Initialise instance of the half_plane structure
+
+    Parameters
+    ----------
+    _px, _py : double
+        a point on the line
+    _dx, _dy : double
+        direction of the line; the half-plane lies to its left
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        px = _px;
+        py = _py;
+        dx = _dx;
+        dy = _dy;
+        angle = std::atan2(dy, dx);
+    }
+
+    bool outside(double qx, double qy, double tolerance) const
+    {
+        return dx * (qy - py) - dy * (qx - px) < -tolerance * std::hypot(dx, dy);
+    }
+};
+
+inline void line_intersection(const half_plane& a, const half_plane& b, double& qx, double& qy)
+/*
+Intersection of the boundary lines of two non-parallel half-planes
+
+Parameters
+----------
+a, b : half_plane
+    the half-planes
+qx, qy : double&
+    set to the coordinates of the intersection
+
+Returns
+-------
+None
+*/
+
+{
+    double t {(b.dx * (a.py - b.py) - b.dy * (a.px - b.px)) / (a.dx * b.dy - a.dy * b.dx)};
+    qx = a.px + t * a.dx;
+    qy = a.py + t * a.dy;
+}
+
+inline convex_polygon intersect_sorted_half_planes(const std::vector<half_plane>& planes, double tolerance)
+/*
+Intersect half-planes which are already sorted by angle, in a single pass with a deque.
+The intersection must be bounded or empty.
+
+Parameters
+----------
+planes : vector<half_plane>
+    half-planes in increasing order of angle
+tolerance : double
+    distance below which a point is treated as lying on a boundary line
+
+Returns
+-------
+intersection : convex_polygon
+    the intersection, empty if the half-planes have no common area
+*/
+
+{
+    std::deque<half_plane> active {};
+    double qx {};
+    double qy {};
+    for (const half_plane& plane : planes)
+    {
+        while (active.size() > 1)
+        {
+            line_intersection(active[active.size() - 1], active[active.size() - 2], qx, qy);
+            if (!plane.outside(qx, qy, tolerance))
+            {
+                break;
+            }
+            active.pop_back();
+        }
+        while (active.size() > 1)
+        {
+            line_intersection(active[0], active[1], qx, qy);
+            if (!plane.outside(qx, qy, tolerance))
+            {
+                break;
+            }
+            active.pop_front();
+        }
+        if (!active.empty())
+        {
+            const half_plane& last {active.back()};
+            double cross {last.dx * plane.dy - last.dy * plane.dx};
+            if (std::fabs(cross) <= 1e-12 * std::hypot(last.dx, last.dy) * std::hypot(plane.dx, plane.dy))
+            {
+                // opposite parallel lines meeting here leave nothing between them
+                if (last.dx * plane.dx + last.dy * plane.dy < 0)
+                {
+                    return convex_polygon();
+                }
+                // same direction, keep the more restrictive
+                if (plane.outside(last.px, last.py, 0))
+                {
+                    active.pop_back();
+                }
+                else
+                {
+                    continue;
+                }
+            }
+        }
+        active.push_back(plane);
+    }
+    while (active.size() > 2)
+    {
+        line_intersection(active[active.size() - 1], active[active.size() - 2], qx, qy);
+        if (!active[0].outside(qx, qy, tolerance))
+        {
+            break;
+        }
+        active.pop_back();
+    }
+    while (active.size() > 2)
+    {
+        line_intersection(active[0], active[1], qx, qy);
+        if (!active.back().outside(qx, qy, tolerance))
+        {
+            break;
+        }
+        active.pop_front();
+    }
+
+    convex_polygon intersection {};
+    if (active.size() < 3)
+    {
+        return intersection;
+    }
+    for (size_t i = 0; i < active.size(); i++)
+    {
+        line_intersection(active[i], active[(i + 1) % active.size()], qx, qy);
+        intersection.x.push_back(qx);
+        intersection.y.push_back(qy);
+    }
+    return intersection;
+}
+
+inline convex_polygon intersect_half_planes(std::vector<half_plane> planes, double bound)
+/*
+Intersect half-planes in any order, in O(n log n).
+The half-planes are sorted by angle and clipped to a square, then passed to the deque intersection. ...
+... Each step is an orientation test of a vertex against a boundary line, with a tolerance scaled to the input.
+
+Parameters
+----------
+planes : vector<half_plane>
+    the half-planes
+bound : double
+    half-width of the square about the origin which the intersection is clipped to, so unbounded ...
+    ... intersections are cut off there
+
+Returns
+-------
+intersection : convex_polygon
+    the intersection in canonical form, empty if the half-planes have no common area
+*/
+
+{
+    double scale {0};
+    for (const half_plane& plane : planes)
+    {
+        scale = std::max(scale, std::max(std::fabs(plane.px), std::fabs(plane.py)));
+    }
+    planes.push_back(half_plane(-bound, -bound, 1, 0));
+    planes.push_back(half_plane(bound, -bound, 0, 1));
+    planes.push_back(half_plane(bound, bound, -1, 0));
+    planes.push_back(half_plane(-bound, bound, 0, -1));
+    std::stable_sort(planes.begin(), planes.end(), [](const half_plane& a, const half_plane& b)
+    {
+        return a.angle < b.angle;
+    });
+
+    convex_polygon intersection {intersect_sorted_half_planes(planes, 64 * std::numeric_limits<double>::epsilon() * scale)};
+    std::vector<point> vertices {};
+    for (int i = 0; i < intersection.size(); i++)
+    {
+        vertices.push_back(point(intersection.x[i], intersection.y[i]));
+    }
+    // lines meeting at a common point leave repeated vertices
+    convex_polygon canonical {vertices};
+    if (canonical.size() < 3)
+    {
+        return convex_polygon();
+    }
+    return canonical;
+}
+
+inline std::vector<half_plane> polygon_half_planes(const convex_polygon& polygon)
+/*
+The half-planes bounded by the edges of a polygon, rotated so their angles increase
+
+Parameters
+----------
+polygon : convex_polygon
+    a polygon with at least three vertices
+
+Returns
+-------
+planes : vector<half_plane>
+    one half-plane per edge, in increasing order of angle
+*/
+
+{
+    int h {polygon.size()};
+    std::vector<half_plane> planes {};
+    for (int i = 0; i < h; i++)
+    {
+        int j {(i + 1) % h};
+        planes.push_back(half_plane(polygon.x[i], polygon.y[i], polygon.x[j] - polygon.x[i], polygon.y[j] - polygon.y[i]));
+    }
+    // edge angles increase around a counterclockwise polygon, apart from one wrap-around
+    std::rotate(planes.begin(), std::min_element(planes.begin(), planes.end(), [](const half_plane& a, const half_plane& b)
+    {
+        return a.angle < b.angle;
+    }), planes.end());
+    return planes;
+}
+
+inline convex_polygon intersect_polygons(const convex_polygon& a, const convex_polygon& b)
+/*
+Intersection of two convex polygons in O(h1 + h2).
+Both edge lists are already sorted by angle, so they are merged and passed to the deque intersection.
+
+Parameters
+----------
+a, b : convex_polygon
+    the polygons
+
+Returns
+-------
+intersection : convex_polygon
+    empty if the polygons have no common area
+*/
+
+{
+    if (a.size() < 3 || b.size() < 3)
+    {
+        return convex_polygon();
+    }
+    std::vector<half_plane> planes_a {polygon_half_planes(a)};
+    std::vector<half_plane> planes_b {polygon_half_planes(b)};
+    std::vector<half_plane> planes {};
+    std::merge(planes_a.begin(), planes_a.end(), planes_b.begin(), planes_b.end(), std::back_inserter(planes),
+               [](const half_plane& p, const half_plane& q)
+    {
+        return p.angle < q.angle;
+    });
+
+    double scale {0};
+    for (int i = 0; i < a.size(); i++)
+    {
+        scale = std::max(scale, std::max(std::fabs(a.x[i]), std::fabs(a.y[i])));
+    }
+    for (int i = 0; i < b.size(); i++)
+    {
+        scale = std::max(scale, std::max(std::fabs(b.x[i]), std::fabs(b.y[i])));
+    }
+    return intersect_sorted_half_planes(planes, 64 * std::numeric_limits<double>::epsilon() * scale);
+}
+
+#endif
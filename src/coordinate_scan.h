@@ -0,0 +1,133 @@
+#ifndef COORDINATE_SCAN_H
+#define COORDINATE_SCAN_H
+
+#include <limits>
+#include <algorithm>
+
+struct coordinate_scan
+/*
+A structure to hold the result of one pass over a set of coordinates: the extremes of the finite points, ...
+... the leftmost of them and how many points have a NaN or infinite coordinate.
+
+Attributes
+----------
+x_min, x_max, y_min, y_max : double
+    extremes over the finite points, infinite (min > max) if there are none
+leftmost : int
+    first finite point with the least x, taking the least y among these; -1 if there are none
+non_finite : int
+    number of points with a non-finite x or y
+
+Methods
+-------
+None
+*/
+{
+    double x_min {std::numeric_limits<double>::infinity()};
+    double x_max {-std::numeric_limits<double>::infinity()};
+    double y_min {std::numeric_limits<double>::infinity()};
+    double y_max {-std::numeric_limits<double>::infinity()};
+    int leftmost {-1};
+    int non_finite {0};
+};
+
+inline bool is_finite_point(double x, double y)
+/*
+Tests whether both coordinates of a point are finite. x - x is NaN exactly when x is NaN or infinite, ...
+... which keeps the test branch-free so that loops using it vectorise.
+
+Parameters
+----------
+x, y : double
+    coordinates of the point
+
+Returns
+-------
+finite : bool
+*/
+
+{
+    return x - x == 0 && y - y == 0;
+}
+
+inline bool is_finite_point(double x, double y, double z)
+/*
+Tests whether all three coordinates of a point are finite, as is_finite_point does in two dimensions
+
+Parameters
+----------
+x, y, z : double
+    coordinates of the point
+
+Returns
+-------
+finite : bool
+*/
+
+{
+    return x - x == 0 && y - y == 0 && z - z == 0;
+}
+
+inline coordinate_scan scan_coordinates(const double* x, const double* y, int n)
+/*
+Validate coordinates and find their extremes and leftmost point in a single pass over memory, so that ...
+... checking for NaN and Inf costs nothing beyond the extreme-point scan a hull needs anyway.
+Points are taken in blocks: a vectorised loop finds the block's extremes and counts its non-finite points, ...
+... and only a block which may hold a new leftmost point is looked at again, while it is still in cache.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+n : int
+    number of points
+
+Returns
+-------
+scan : coordinate_scan
+*/
+
+{
+    const double infinity {std::numeric_limits<double>::infinity()};
+    const int block {256};
+    coordinate_scan scan {};
+    for (int start = 0; start < n; start += block)
+    {
+        int end {std::min(n, start + block)};
+        double x_min {infinity};
+        double x_max {-infinity};
+        double y_min {infinity};
+        double y_max {-infinity};
+        int non_finite {0};
+        #pragma omp simd reduction(min:x_min,y_min) reduction(max:x_max,y_max) reduction(+:non_finite)
+        for (int i = start; i < end; i++)
+        {
+            bool finite {is_finite_point(x[i], y[i])};
+            non_finite += finite ? 0 : 1;
+            x_min = std::min(x_min, finite ? x[i] : infinity);
+            x_max = std::max(x_max, finite ? x[i] : -infinity);
+            y_min = std::min(y_min, finite ? y[i] : infinity);
+            y_max = std::max(y_max, finite ? y[i] : -infinity);
+        }
+
+        if (x_min < infinity && x_min <= scan.x_min)
+        {
+            for (int i = start; i < end; i++)
+            {
+                if (x[i] == x_min && is_finite_point(x[i], y[i]) &&
+                    (scan.leftmost < 0 || x[i] < x[scan.leftmost] || y[i] < y[scan.leftmost]))
+                {
+                    scan.leftmost = i;
+                }
+            }
+        }
+        scan.x_min = std::min(scan.x_min, x_min);
+        scan.x_max = std::max(scan.x_max, x_max);
+        scan.y_min = std::min(scan.y_min, y_min);
+        scan.y_max = std::max(scan.y_max, y_max);
+        scan.non_finite += non_finite;
+    }
+    return scan;
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include <vector>
+
+#include "dynamic_hull.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+std::vector<int> row_ids(IntegerVector rows)
+/*
+Convert R row numbers to 0-based row ids
+
+Parameters
+----------
+rows : IntegerVector
+    row numbers, from 1
+
+Returns
+-------
+ids : vector<int>
+    row ids, from 0; NA becomes -1 and is rejected as out of range
+*/
+
+{
+    std::vector<int> ids (rows.size());
+    for (int i = 0; i < rows.size(); i++)
+    {
+        ids[i] = rows[i] == NA_INTEGER ? -1 : rows[i] - 1;
+    }
+    return ids;
+}
+
+// [[Rcpp::export]]
+XPtr<dynamic_hull> dynamic_hull_create(NumericVector x, NumericVector y)
+/*
+Create a convex hull of a table of points which can be kept up to date from change logs (for R package build).
+The hull lives in native memory and is kept between calls; every row of the table starts present.
+
+Parameters
+----------
+x : NumericVector
+    x coords of the rows
+y : NumericVector
+    y coords of the rows
+
+Returns
+-------
+hull : XPtr<dynamic_hull>
+    external pointer to the hull
+*/
+
+{
+    if (x.size() != y.size())
+    {
+        stop("x and y must have the same length");
+    }
+    return XPtr<dynamic_hull>(new dynamic_hull(x.begin(), y.begin(), (int) x.size()), true);
+}
+
+// [[Rcpp::export]]
+void dynamic_hull_update(XPtr<dynamic_hull> hull, NumericVector x, NumericVector y, IntegerVector inserted,
+                         IntegerVector deleted, IntegerVector modified)
+/*
+Apply a change log to a hull from dynamic_hull_create (for R package build).
+The hull is only rebuilt where deleted or modified rows were hull vertices, and then only locally.
+The log is checked in full first, so an invalid log leaves the hull unchanged.
+
+Parameters
+----------
+hull : XPtr<dynamic_hull>
+    the hull
+x : NumericVector
+    current x coords of the table, by row number; only read for inserted and modified rows
+y : NumericVector
+    current y coords of the table
+inserted : IntegerVector
+    rows added since the last update
+deleted : IntegerVector
+    rows removed since the last update
+modified : IntegerVector
+    rows whose coordinates have changed since the last update
+
+Returns
+-------
+None
+*/
+
+{
+    if (x.size() != y.size())
+    {
+        stop("x and y must have the same length");
+    }
+    hull->update(x.begin(), y.begin(), (int) x.size(), row_ids(inserted), row_ids(deleted), row_ids(modified));
+}
+
+// [[Rcpp::export]]
+IntegerVector dynamic_hull_vertices(XPtr<dynamic_hull> hull)
+/*
+Rows on a hull from dynamic_hull_create (for R package build).
+
+Parameters
+----------
+hull : XPtr<dynamic_hull>
+    the hull
+
+Returns
+-------
+vertices : IntegerVector
+    row numbers of the hull vertices, counterclockwise from the lowest leftmost
+*/
+
+{
+    IntegerVector vertices(hull->hull.size());
+    for (int i = 0; i < vertices.size(); i++)
+    {
+        vertices[i] = hull->hull[i] + 1;
+    }
+    return vertices;
+}
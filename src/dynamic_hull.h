@@ -0,0 +1,327 @@
+#ifndef DYNAMIC_HULL_H
+#define DYNAMIC_HULL_H
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "geometry.h"
+#include "monotone_chain.h"
+#include "coordinate_scan.h"
+
+struct dynamic_hull
+/*
+A structure to maintain the convex hull of a table of points under row-level changes.
+Rows are identified by a stable id (their position in the table), and a change log gives the ids ...
+... inserted, deleted and modified since the last update; a modification is a deletion followed by an insertion.
+
+Deleting points which are not hull vertices cannot change the hull. Deleting vertices leaves the ...
+... surviving vertices on the hull, and any new vertices lie in the pockets between the old chain and ...
+... the segments joining consecutive survivors, so only the points in those pockets are rebuilt with the monotone chain.
+Inserted points only change the hull if they lie outside it, and the new hull is the hull of the old ...
+... vertices and the inserted points.
+
+Attributes
+----------
+x, y : vector<double>
+    coordinates of every row seen so far
+alive : vector<char>
+    1 for rows currently in the table
+on_hull : vector<char>
+    1 for rows which are hull vertices
+hull : vector<int>
+    ids of the hull vertices, in canonical form (see canonical_hull.h)
+
+Methods
+-------
+update:
+    apply a change log
+*/
+{
+    std::vector<double> x {};
+    std::vector<double> y {};
+    std::vector<char> alive {};
+    std::vector<char> on_hull {};
+    std::vector<int> hull {};
+
+    dynamic_hull(const double* _x, const double* _y, int n)
+    /*
+    Initialise instance of the dynamic_hull structure, with every row of the table present
+
+    Parameters
+    ----------
+    _x, _y : const double*
+        coordinates of the rows
+    n : int
+        number of rows
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        if (scan_coordinates(_x, _y, n).non_finite > 0)
+        {
+            throw std::invalid_argument("coordinates must be finite");
+        }
+        x.assign(_x, _x + n);
+        y.assign(_y, _y + n);
+        alive.assign(n, 1);
+        on_hull.assign(n, 0);
+        set_hull(monotone_chain(x.data(), y.data(), sort_points(x.data(), y.data(), n)));
+    }
+
+    void set_hull(const std::vector<int>& vertices)
+    {
+        for (int v : hull)
+        {
+            on_hull[v] = 0;
+        }
+        hull = vertices;
+        for (int v : hull)
+        {
+            on_hull[v] = 1;
+        }
+    }
+
+    void rebuild()
+    /*
+    Recompute the hull from every row in the table
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        std::vector<int> ids {};
+        for (int i = 0; i < (int) alive.size(); i++)
+        {
+            if (alive[i] == 1)
+            {
+                ids.push_back(i);
+            }
+        }
+        sort_subset(x.data(), y.data(), ids);
+        set_hull(monotone_chain(x.data(), y.data(), ids));
+    }
+
+    void repair(const std::vector<char>& removed)
+    /*
+    Restore the hull after some of its vertices have been deleted.
+    The pocket of a pair of consecutive survivors a, b is the part of the old hull strictly right of a -> b, ...
+    ... so each remaining point lies in at most one pocket, and the chain replacing the deleted vertices ...
+    ... is the part of the hull of a, b and the pocket points running from a to b.
+
+    Parameters
+    ----------
+    removed : vector<char>
+        1 for the old hull vertices which have been deleted, by position in hull
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        int h {(int) hull.size()};
+        std::vector<int> survivors {};
+        std::vector<char> gap_after {};
+        for (int i = 0; i < h; i++)
+        {
+            if (removed[i] == 0)
+            {
+                survivors.push_back(hull[i]);
+                gap_after.push_back(0);
+            }
+            else if (!survivors.empty())
+            {
+                gap_after.back() = 1;
+            }
+        }
+        if (h < 3 || survivors.size() < 2)
+        {
+            rebuild();
+            return;
+        }
+        // deleted vertices before the first survivor belong to the gap after the last
+        if (removed[0] == 1)
+        {
+            gap_after.back() = 1;
+        }
+
+        int s {(int) survivors.size()};
+        std::vector<int> gaps {};
+        for (int i = 0; i < s; i++)
+        {
+            if (gap_after[i] == 1)
+            {
+                gaps.push_back(i);
+            }
+        }
+        std::vector<std::vector<int> > pockets (s);
+        for (int p = 0; p < (int) alive.size(); p++)
+        {
+            if (alive[p] == 0 || on_hull[p] == 1)
+            {
+                continue;
+            }
+            point q(x[p], y[p]);
+            for (int i : gaps)
+            {
+                int a {survivors[i]};
+                int b {survivors[(i + 1) % s]};
+                if (orientation(point(x[a], y[a]), point(x[b], y[b]), q) < 0)
+                {
+                    pockets[i].push_back(p);
+                    break;
+                }
+            }
+        }
+
+        std::vector<int> repaired {};
+        for (int i = 0; i < s; i++)
+        {
+            int a {survivors[i]};
+            int b {survivors[(i + 1) % s]};
+            repaired.push_back(a);
+            if (pockets[i].empty())
+            {
+                continue;
+            }
+            std::vector<int> ids {pockets[i]};
+            ids.push_back(a);
+            ids.push_back(b);
+            sort_subset(x.data(), y.data(), ids);
+            std::vector<int> chain {monotone_chain(x.data(), y.data(), ids)};
+            int start {(int) (std::find(chain.begin(), chain.end(), a) - chain.begin())};
+            for (int j = 1; j < (int) chain.size(); j++)
+            {
+                int v {chain[(start + j) % chain.size()]};
+                if (v == b)
+                {
+                    break;
+                }
+                repaired.push_back(v);
+            }
+        }
+
+        // back to canonical form: counterclockwise from the lowest leftmost vertex
+        const double* px {x.data()};
+        const double* py {y.data()};
+        std::rotate(repaired.begin(), std::min_element(repaired.begin(), repaired.end(), [px, py](int a, int b)
+        {
+            if (px[a] != px[b]) return px[a] < px[b];
+            return py[a] < py[b];
+        }), repaired.end());
+        set_hull(repaired);
+    }
+
+    void update(const double* table_x, const double* table_y, int n, const std::vector<int>& inserted,
+                const std::vector<int>& deleted, const std::vector<int>& modified)
+    /*
+    Apply a change log. The log is checked in full before anything is changed.
+
+    Parameters
+    ----------
+    table_x, table_y : const double*
+        current coordinates of the table, by row id; only read for inserted and modified rows
+    n : int
+        number of rows in the table
+    inserted, deleted, modified : vector<int>
+        ids of the rows changed, 0-based; each id may appear once in the whole log
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        if ((int) alive.size() < n)
+        {
+            x.resize(n, 0);
+            y.resize(n, 0);
+            alive.resize(n, 0);
+            on_hull.resize(n, 0);
+        }
+        std::vector<char> seen (alive.size(), 0);
+        auto check = [this, &seen, n](const std::vector<int>& ids, bool present, bool read)
+        {
+            for (int id : ids)
+            {
+                if (id < 0 || id >= (int) alive.size() || (read && id >= n))
+                {
+                    throw std::invalid_argument("row id out of range");
+                }
+                if (seen[id] == 1)
+                {
+                    throw std::invalid_argument("each row id may appear only once in the change log");
+                }
+                seen[id] = 1;
+                if ((alive[id] == 1) != present)
+                {
+                    throw std::invalid_argument(present ? "deleted and modified rows must be present" : "inserted rows must not be present");
+                }
+            }
+        };
+        check(inserted, false, true);
+        check(deleted, true, false);
+        check(modified, true, true);
+        for (const std::vector<int>* ids : {&inserted, &modified})
+        {
+            for (int id : *ids)
+            {
+                if (!is_finite_point(table_x[id], table_y[id]))
+                {
+                    throw std::invalid_argument("coordinates must be finite");
+                }
+            }
+        }
+
+        // deletions, repairing the hull only if one of its vertices goes
+        int h {(int) hull.size()};
+        bool vertex_removed {false};
+        for (const std::vector<int>* ids : {&deleted, &modified})
+        {
+            for (int id : *ids)
+            {
+                alive[id] = 0;
+                vertex_removed = vertex_removed || on_hull[id] == 1;
+            }
+        }
+        if (vertex_removed)
+        {
+            std::vector<char> removed (h, 0);
+            for (int i = 0; i < h; i++)
+            {
+                removed[i] = alive[hull[i]] == 0 ? 1 : 0;
+            }
+            repair(removed);
+        }
+
+        // insertions: the new hull is the hull of the old vertices and the inserted points
+        std::vector<int> ids {hull};
+        for (const std::vector<int>* changed : {&inserted, &modified})
+        {
+            for (int id : *changed)
+            {
+                x[id] = table_x[id];
+                y[id] = table_y[id];
+                alive[id] = 1;
+                ids.push_back(id);
+            }
+        }
+        if (ids.size() > hull.size())
+        {
+            sort_subset(x.data(), y.data(), ids);
+            set_hull(monotone_chain(x.data(), y.data(), ids));
+        }
+    }
+};
+
+#endif
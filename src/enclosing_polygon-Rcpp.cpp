@@ -0,0 +1,79 @@
+#include <vector>
+
+#include "geometry.h"
+#include "convex_polygon.h"
+#include "enclosing_polygon.h"
+#include "groups.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+List enclosing_polygons(NumericVector x, NumericVector y, IntegerVector group, int k = 3)
+/*
+Find a small polygon with at most k sides enclosing each hull in a grouped result (for R package build).
+For k = 3 this is the triangle of least area; for larger k an approximation to the k-gon of least area. ...
+... Groups are processed in parallel.
+
+Parameters
+----------
+x, y : NumericVector
+    coordinates of the hull vertices, e.g. from find_convex_hull
+group : IntegerVector
+    hull each vertex belongs to; the vertices of each hull must be in consecutive rows
+k : int
+    number of sides, at least 3
+
+Returns
+-------
+polygons : List
+    x, y : NumericVector
+        vertices of the enclosing polygons, in canonical form
+    group : IntegerVector
+        group value of each vertex, so the polygons form a grouped result
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n || group.size() != n)
+    {
+        stop("x, y and group must have the same length");
+    }
+    if (k < 3)
+    {
+        stop("k must be at least 3");
+    }
+    std::vector<int> starts {find_group_starts(group.begin(), n)};
+    int n_groups {(int) starts.size() - 1};
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    std::vector<convex_polygon> polygons (n_groups);
+    #pragma omp parallel for schedule(dynamic)
+    for (int g = 0; g < n_groups; g++)
+    {
+        std::vector<point> hull {};
+        for (int i = starts[g]; i < starts[g + 1]; i++)
+        {
+            hull.push_back(point(px[i], py[i]));
+        }
+        polygons[g] = enclosing_polygon(convex_polygon(hull), k);
+    }
+
+    // output
+    std::vector<double> out_x {};
+    std::vector<double> out_y {};
+    std::vector<int> out_group {};
+    for (int g = 0; g < n_groups; g++)
+    {
+        for (int i = 0; i < polygons[g].size(); i++)
+        {
+            out_x.push_back(polygons[g].x[i]);
+            out_y.push_back(polygons[g].y[i]);
+            out_group.push_back(group[starts[g]]);
+        }
+    }
+    return List::create(Named("x") = out_x,
+                        Named("y") = out_y,
+                        Named("group") = out_group);
+}
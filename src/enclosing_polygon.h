@@ -0,0 +1,387 @@
+#ifndef ENCLOSING_POLYGON_H
+#define ENCLOSING_POLYGON_H
+
+#include <vector>
+#include <queue>
+#include <limits>
+#include <cmath>
+
+#include "geometry.h"
+#include "convex_polygon.h"
+
+struct enclosing_triangle
+/*
+A structure to represent a triangle enclosing a convex polygon
+
+Attributes
+----------
+x, y : double[3]
+    coordinates of the corners
+area : double
+    area of the triangle, infinite if no triangle has been found
+
+Methods
+-------
+None
+*/
+{
+    double x[3] {};
+    double y[3] {};
+    double area {std::numeric_limits<double>::infinity()};
+};
+
+inline bool turns_left(const half_plane& a, const half_plane& b)
+/*
+Tests whether the line of b turns left from the line of a by less than a half turn, ...
+... treating lines within rounding error of parallel as parallel
+
+Parameters
+----------
+a, b : half_plane
+    the half-planes
+
+Returns
+-------
+left : bool
+*/
+
+{
+    return a.dx * b.dy - a.dy * b.dx > 1e-12 * std::hypot(a.dx, a.dy) * std::hypot(b.dx, b.dy);
+}
+
+inline void flush_triangle(const half_plane& a, const half_plane& b, const half_plane& c, enclosing_triangle& best)
+/*
+Keep the triangle bounded by three edge lines of a polygon if it is smaller than the best so far.
+The lines bound a triangle containing the polygon when each turns left onto the next by less than a half turn.
+
+Parameters
+----------
+a, b, c : half_plane
+    half-planes bounded by the edge lines, in counterclockwise order
+best : enclosing_triangle&
+    smallest triangle found so far
+
+Returns
+-------
+None
+*/
+
+{
+    if (!turns_left(a, b) || !turns_left(b, c) || !turns_left(c, a))
+    {
+        return;
+    }
+    enclosing_triangle triangle {};
+    line_intersection(c, a, triangle.x[0], triangle.y[0]);
+    line_intersection(a, b, triangle.x[1], triangle.y[1]);
+    line_intersection(b, c, triangle.x[2], triangle.y[2]);
+    triangle.area = cross_product(triangle.x[0], triangle.y[0], triangle.x[1], triangle.y[1], triangle.x[2], triangle.y[2]) / 2;
+    if (triangle.area < best.area)
+    {
+        best = triangle;
+    }
+}
+
+inline void midpoint_triangle(const convex_polygon& polygon, const std::vector<half_plane>& edges, int a, int c, int v,
+                              enclosing_triangle& best)
+/*
+Keep the triangle cut from the wedge between two edge lines by the line through vertex v which has v at its midpoint, ...
+... if that line touches the polygon only at v and the triangle is smaller than the best so far.
+Rotating the third side about v cannot then reduce the area.
+
+Parameters
+----------
+polygon : convex_polygon
+    the polygon
+edges : vector<half_plane>
+    half-planes bounded by the edge lines of the polygon
+a, c : int
+    the two edges, c turning left from a by less than a half turn
+v : int
+    vertex of the polygon, not an end of edge a or c
+best : enclosing_triangle&
+    smallest triangle found so far
+
+Returns
+-------
+None
+*/
+
+{
+    int h {polygon.size()};
+    if (v == a || v == (a + 1) % h || v == c || v == (c + 1) % h)
+    {
+        return;
+    }
+    const half_plane& first {edges[a]};
+    const half_plane& second {edges[c]};
+    double qx {};
+    double qy {};
+    line_intersection(first, second, qx, qy);
+
+    // v = q + alpha (-a direction) + beta (c direction)
+    double determinent {second.dx * first.dy - second.dy * first.dx};
+    double alpha {((polygon.x[v] - qx) * second.dy - (polygon.y[v] - qy) * second.dx) / determinent};
+    double beta {(-first.dx * (polygon.y[v] - qy) + first.dy * (polygon.x[v] - qx)) / determinent};
+    if (!(alpha > 0) || !(beta > 0))
+    {
+        return;
+    }
+    enclosing_triangle triangle {};
+    triangle.x[0] = qx;
+    triangle.y[0] = qy;
+    triangle.x[1] = qx + 2 * beta * second.dx;
+    triangle.y[1] = qy + 2 * beta * second.dy;
+    triangle.x[2] = qx - 2 * alpha * first.dx;
+    triangle.y[2] = qy - 2 * alpha * first.dy;
+
+    // the neighbours of v must not lie beyond the new side
+    for (int w : {(v + h - 1) % h, (v + 1) % h})
+    {
+        if (cross_product(triangle.x[1], triangle.y[1], triangle.x[2], triangle.y[2], polygon.x[w], polygon.y[w]) < 0)
+        {
+            return;
+        }
+    }
+    triangle.area = cross_product(triangle.x[0], triangle.y[0], triangle.x[1], triangle.y[1], triangle.x[2], triangle.y[2]) / 2;
+    if (triangle.area < best.area)
+    {
+        best = triangle;
+    }
+}
+
+inline enclosing_triangle min_enclosing_triangle(const convex_polygon& polygon)
+/*
+Find the triangle of least area enclosing a convex polygon.
+Each side of a locally minimal triangle is either flush with an edge or touches the polygon at its midpoint, ...
+... and two sides touching at single vertices would need those vertices to be equally far from the third side, ...
+... so some minimal triangle has two flush sides. For each pair of edges the best third side is found by a ...
+... binary search, as the area is unimodal in the angle of the third side, giving O(h^2 log h) in all.
+
+Parameters
+----------
+polygon : convex_polygon
+    polygon with at least three vertices
+
+Returns
+-------
+triangle : enclosing_triangle
+    corners counterclockwise
+*/
+
+{
+    int h {polygon.size()};
+    std::vector<half_plane> edges {};
+    for (int i = 0; i < h; i++)
+    {
+        int j {(i + 1) % h};
+        edges.push_back(half_plane(polygon.x[i], polygon.y[i], polygon.x[j] - polygon.x[i], polygon.y[j] - polygon.y[i]));
+    }
+    auto turn = [&edges](int i, int j)
+    {
+        return turns_left(edges[i], edges[j]);
+    };
+
+    enclosing_triangle best {};
+    for (int a = 0; a < h; a++)
+    {
+        for (int c = (a + 1) % h; c != a; c = (c + 1) % h)
+        {
+            if (!turn(a, c))
+            {
+                break;
+            }
+            // the third side lies along the chain of edges c + 1, ..., a - 1
+            int m {(a - c - 1 + h) % h};
+            auto edge = [c, h](int t)
+            {
+                return (c + 1 + t) % h;
+            };
+            // chain edges first to turn right from c, and last to turn right onto a
+            int low {0};
+            int high {m};
+            while (low < high)
+            {
+                int middle {(low + high) / 2};
+                if (turn(c, edge(middle)))
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+            int p {low};
+            low = 0;
+            high = m;
+            while (low < high)
+            {
+                int middle {(low + high) / 2};
+                if (turn(edge(middle), a))
+                {
+                    high = middle;
+                }
+                else
+                {
+                    low = middle + 1;
+                }
+            }
+            int q {low};
+
+            if (q >= p)
+            {
+                // every admissible third side touches the same vertex
+                midpoint_triangle(polygon, edges, a, c, edge(p), best);
+                continue;
+            }
+
+            // flush third sides q, ..., p - 1: least area by binary search on the unimodal sequence
+            auto area = [&edges, a, c, &edge](int t)
+            {
+                enclosing_triangle triangle {};
+                flush_triangle(edges[a], edges[c], edges[edge(t)], triangle);
+                return triangle.area;
+            };
+            low = q;
+            high = p - 1;
+            while (low < high)
+            {
+                int middle {(low + high) / 2};
+                if (area(middle) <= area(middle + 1))
+                {
+                    high = middle;
+                }
+                else
+                {
+                    low = middle + 1;
+                }
+            }
+            flush_triangle(edges[a], edges[c], edges[edge(low)], best);
+            midpoint_triangle(polygon, edges, a, c, edge(low), best);
+            midpoint_triangle(polygon, edges, a, c, (edge(low) + 1) % h, best);
+        }
+    }
+    return best;
+}
+
+inline convex_polygon enclosing_polygon(const convex_polygon& polygon, int k)
+/*
+Find a polygon with at most k sides enclosing a convex polygon, approximating the one of least area.
+Edges are removed greedily from a heap, each time taking the edge whose removal adds the least area: ...
+... the triangle between the edge and the point where the lines of its neighbours meet. This costs O(h log h).
+Greedy removal can stall at a parallelogram, so for k = 3 the exact min_enclosing_triangle is used instead.
+
+Parameters
+----------
+polygon : convex_polygon
+    the polygon
+k : int
+    number of sides wanted, at least three
+
+Returns
+-------
+enclosing : convex_polygon
+    in canonical form; the polygon itself if it has at most k vertices
+*/
+
+{
+    int h {polygon.size()};
+    if (h <= k)
+    {
+        return polygon;
+    }
+    if (k == 3)
+    {
+        enclosing_triangle triangle {min_enclosing_triangle(polygon)};
+        std::vector<point> corners {};
+        for (int i = 0; i < 3; i++)
+        {
+            corners.push_back(point(triangle.x[i], triangle.y[i]));
+        }
+        return convex_polygon(corners);
+    }
+    std::vector<half_plane> edges {};
+    for (int i = 0; i < h; i++)
+    {
+        int j {(i + 1) % h};
+        edges.push_back(half_plane(polygon.x[i], polygon.y[i], polygon.x[j] - polygon.x[i], polygon.y[j] - polygon.y[i]));
+    }
+
+    std::vector<int> previous (h);
+    std::vector<int> next (h);
+    std::vector<int> version (h, 0);
+    // area added by removing edge i: the neighbours of i must turn left by less than a half turn
+    auto cost = [&edges, &previous, &next](int i)
+    {
+        const half_plane& before {edges[previous[i]]};
+        const half_plane& after {edges[next[i]]};
+        if (!turns_left(before, after))
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+        double start_x {};
+        double start_y {};
+        double end_x {};
+        double end_y {};
+        double apex_x {};
+        double apex_y {};
+        line_intersection(before, edges[i], start_x, start_y);
+        line_intersection(edges[i], after, end_x, end_y);
+        line_intersection(before, after, apex_x, apex_y);
+        return std::fabs(cross_product(start_x, start_y, end_x, end_y, apex_x, apex_y)) / 2;
+    };
+
+    std::priority_queue<std::pair<double, std::pair<int, int> >, std::vector<std::pair<double, std::pair<int, int> > >,
+                        std::greater<std::pair<double, std::pair<int, int> > > > removals {};
+    for (int i = 0; i < h; i++)
+    {
+        previous[i] = (i + h - 1) % h;
+        next[i] = (i + 1) % h;
+    }
+    for (int i = 0; i < h; i++)
+    {
+        removals.push({cost(i), {i, 0}});
+    }
+
+    int remaining {h};
+    while (remaining > k && !removals.empty())
+    {
+        double added {removals.top().first};
+        int i {removals.top().second.first};
+        int stamp {removals.top().second.second};
+        removals.pop();
+        if (stamp != version[i])
+        {
+            continue;
+        }
+        if (std::isinf(added))
+        {
+            break;
+        }
+        version[i] = -1;
+        next[previous[i]] = next[i];
+        previous[next[i]] = previous[i];
+        remaining--;
+        for (int j : {previous[i], next[i]})
+        {
+            version[j]++;
+            removals.push({cost(j), {j, version[j]}});
+        }
+    }
+
+    std::vector<point> corners {};
+    for (int i = 0; i < h; i++)
+    {
+        if (version[i] >= 0)
+        {
+            double qx {};
+            double qy {};
+            line_intersection(edges[previous[i]], edges[i], qx, qy);
+            corners.push_back(point(qx, qy));
+        }
+    }
+    return convex_polygon(corners);
+}
+
+#endif
@@ -0,0 +1,267 @@
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+
+#include <cmath>
+
+struct point
+/*
+A structure to represent a single point on a two-dimensional plane
+
+Attributes
+----------
+x : double
+    x-coordinate
+y : double
+    y-coordinate
+
+Methods
+-------
+None
+*/    
+{  
+    double x;
+    double y;
+    
+    point(double _x,double _y)
+    /*
+    Initialise instance of the point structure
+
+    Parameters
+    ----------
+    _x : double
+        x-coordinate
+    _y : double
+        y-coordinate
+
+    Returns
+    -------
+    None
+    */
+        
+    {
+        x = _x;
+        y = _y;   
+    }
+};
+
+inline void two_sum(double a, double b, double& sum, double& error)
+/*
+Sum of two doubles with its rounding error, so that sum + error == a + b exactly
+
+Parameters
+----------
+a, b : double
+    the terms
+sum, error : double&
+    set to the rounded sum and its error
+
+Returns
+-------
+None
+*/
+
+{
+    sum = a + b;
+    double b_virtual {sum - a};
+    double a_virtual {sum - b_virtual};
+    error = (a - a_virtual) + (b - b_virtual);
+}
+
+inline int exact_cross_sign(const point& p1, const point& p2, const point& p3)
+/*
+Sign of the cross product used by triplet_of_points, computed exactly.
+The differences and products are split into exact two-term sums, and the terms are added into a ...
+... non-overlapping expansion whose largest term gives the sign. Only needed when the rounded ...
+... cross product is too close to zero to be trusted.
+
+Parameters
+----------
+p1, p2, p3 : point
+    the triplet
+
+Returns
+-------
+sign : int
+    sign of (p1 - p2) x (p3 - p2)
+*/
+
+{
+    double a[2][2] {};
+    double b[2][2] {};
+    two_sum(p1.x, -p2.x, a[0][0], a[0][1]);
+    two_sum(p1.y, -p2.y, a[1][0], a[1][1]);
+    two_sum(p3.x, -p2.x, b[0][0], b[0][1]);
+    two_sum(p3.y, -p2.y, b[1][0], b[1][1]);
+
+    double expansion[32] {};
+    int length {0};
+    auto grow = [&expansion, &length](double term)
+    {
+        int kept {0};
+        for (int i = 0; i < length; i++)
+        {
+            double error {};
+            two_sum(term, expansion[i], term, error);
+            if (error != 0)
+            {
+                expansion[kept++] = error;
+            }
+        }
+        if (term != 0)
+        {
+            expansion[kept++] = term;
+        }
+        length = kept;
+    };
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            // a.x b.y - b.x a.y, each product exact as a rounded product plus its error
+            double product {a[0][i] * b[1][j]};
+            grow(product);
+            grow(std::fma(a[0][i], b[1][j], -product));
+            product = b[0][i] * a[1][j];
+            grow(-product);
+            grow(-std::fma(b[0][i], a[1][j], -product));
+        }
+    }
+    if (length == 0)
+    {
+        return 0;
+    }
+    return expansion[length - 1] > 0 ? 1 : -1;
+}
+
+struct triplet_of_points
+/*
+A structure to represent a group of three points (one, two and three) on a two-dimensional plane
+
+Attributes
+----------
+right_turn : 
+    True if a traversal from point 1 to point 3 via point 2 involves a right turn.
+    I.e. if the counterclockwise angle between a and b is 180 degrees or less. 
+    If the traversal involves just a straight line, right_turn = True
+    If the traversal involves a 360 degree turn, right_turn = False
+collinearity : 
+    True if the three points are collinear. 
+a :
+    the dimensions of the line between the first and second point in the triplet
+b : 
+    the dimensions of the line between the third and second point in the triplet
+determinent : 
+    the determinent of matrix (a^T, b^T)
+    I.e. the cross product between a and b. 
+    If it is too close to zero for its rounded sign to be trusted, it is replaced by its exact sign.
+dot_product : 
+    the dot product of a and b
+
+Methods
+-------
+find_orientation:
+    determines whether a traversal from point 1 to point 3 via point 2 involves a right turn. 
+*/    
+{  
+    bool right_turn {};
+    bool collinearity {};
+    double determinent {};
+    double dot_product {};
+    
+    triplet_of_points(point p1, point p2, point p3)
+    /*
+    Initialise instance of the triplet_of_points class
+
+    Parameters
+    ----------
+    p1 : point
+        First point in triplet
+    p2 : point
+        Second point in triplet
+    p3 : point
+        Third point in triplet
+    Returns
+    -------
+    None
+    */
+        
+    {
+        point a(p1.x - p2.x, p1.y - p2.y);
+        point b(p3.x - p2.x, p3.y - p2.y);
+        determinent = a.x * b.y - b.x * a.y;
+        dot_product = a.x * b.x + a.y * b.y ; 
+        // floating-point filter: below this bound the sign of the rounded determinent may be wrong
+        if (!(std::fabs(determinent) > 3.3306690738754716e-16 * (std::fabs(a.x * b.y) + std::fabs(b.x * a.y))))
+        {
+            determinent = exact_cross_sign(p1, p2, p3);
+        }
+    }
+    
+    void find_orientation()
+    /*
+    Find the orientation (i.e. right-turning or not) of the triplet. 
+    Also identify if points on triplet are collinear 
+
+    Parameters
+    ----------
+    None
+    
+    Returns
+    -------
+    None
+    */
+      
+    {        
+        if (determinent > 0) // right turn
+        {
+            right_turn = true;
+            collinearity = false;
+        }
+        else if (determinent == 0 && dot_product < 0) // straight line, categorised as right turn
+        {
+            right_turn = true;
+            collinearity = true;
+        }
+        else if (determinent == 0 && dot_product > 0) // back on itselft, cateogorised as left turn
+        {
+            right_turn = false;
+            collinearity = true;
+        }
+        else if (determinent < 0) // left turn
+        {
+            right_turn = false;
+            collinearity = false;
+        }
+    }
+};
+
+inline int orientation(const point& p1, const point& p2, const point& p3)
+/*
+Orientation of a traversal from p1 to p3 via p2, following the conventions of triplet_of_points.
+
+Parameters
+----------
+p1 : point
+    First point in triplet
+p2 : point
+    Second point in triplet
+p3 : point
+    Third point in triplet
+
+Returns
+-------
+orientation : int
+    +1 for a left (counterclockwise) turn, -1 for a right turn and 0 if the points are collinear
+*/
+
+{
+    triplet_of_points triplet(p1, p2, p3);
+    triplet.find_orientation();
+    if (triplet.collinearity == true)
+    {
+        return 0;
+    }
+    return triplet.right_turn == true ? -1 : 1;
+}
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef GROUPS_H
+#define GROUPS_H
+
+#include <vector>
+
+inline std::vector<int> find_group_starts(const int* group, int n)
+/*
+Find where each group starts in a grouped result.
+A group is a run of consecutive rows with the same group value, as in the output of the grouped routines.
+
+Parameters
+----------
+group : const int*
+    group value of each row
+n : int
+    number of rows
+
+Returns
+-------
+starts : vector<int>
+    first row of each group, followed by n, so group g occupies rows starts[g] to starts[g+1] - 1
+*/
+
+{
+    std::vector<int> starts {};
+    for (int i = 0; i < n; i++)
+    {
+        if (i == 0 || group[i] != group[i - 1])
+        {
+            starts.push_back(i);
+        }
+    }
+    starts.push_back(n);
+    return starts;
+}
+
+#endif
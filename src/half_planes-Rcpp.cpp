@@ -0,0 +1,67 @@
+#include <vector>
+#include <cmath>
+
+#include "convex_polygon.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+List half_plane_intersection(NumericVector a, NumericVector b, NumericVector c, double bound = 1e9)
+/*
+Find the region satisfying a set of linear constraints a x + b y <= c (for R package build).
+
+Parameters
+----------
+a, b, c : NumericVector
+    coefficients of each constraint
+bound : double
+    the region is clipped to the square |x|, |y| <= bound, so unbounded regions are cut off there
+
+Returns
+-------
+region : List
+    x, y : NumericVector
+        vertices of the region, counterclockwise from the lowest leftmost vertex. Empty if the region is empty.
+    area : double
+        area of the region
+    empty : bool
+        True if the constraints have no common area
+*/
+
+{
+    int n {(int) a.size()};
+    if (b.size() != n || c.size() != n)
+    {
+        stop("a, b and c must have the same length");
+    }
+    if (!(bound > 0) || !std::isfinite(bound))
+    {
+        stop("bound must be positive and finite");
+    }
+
+    // the half-plane a x + b y <= c lies to the left of the direction (-b, a)
+    std::vector<half_plane> planes {};
+    for (int i = 0; i < n; i++)
+    {
+        double norm {a[i] * a[i] + b[i] * b[i]};
+        if (norm == 0)
+        {
+            if (c[i] < 0)
+            {
+                return List::create(Named("x") = NumericVector(0),
+                                    Named("y") = NumericVector(0),
+                                    Named("area") = 0.0,
+                                    Named("empty") = true);
+            }
+            continue;
+        }
+        planes.push_back(half_plane(a[i] * c[i] / norm, b[i] * c[i] / norm, -b[i], a[i]));
+    }
+
+    convex_polygon region {intersect_half_planes(planes, bound)};
+    return List::create(Named("x") = region.x,
+                        Named("y") = region.y,
+                        Named("area") = region.area(),
+                        Named("empty") = region.size() == 0);
+}
@@ -0,0 +1,295 @@
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "quickhull.h"
+#include "coordinate_scan.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+struct facet_planes
+/*
+A structure holding the facet hyperplanes of a 3D hull in structure-of-arrays layout, ...
+... so the half-space tests for one query point run as a single vectorised loop over facets.
+
+Attributes
+----------
+nx, ny, nz : vector<double>
+    components of the unit outward normal of each facet
+offset : vector<double>
+    offset of each facet, such that normal . x = offset on the facet
+lower, upper : double[3]
+    corners of the bounding box of the hull, used to reject far away points cheaply
+tolerance : double
+    points at most this far outside a facet are treated as lying on it
+
+Methods
+-------
+contains:
+    tests whether a point lies inside the hull
+*/
+{
+    std::vector<double> nx {};
+    std::vector<double> ny {};
+    std::vector<double> nz {};
+    std::vector<double> offset {};
+    double lower[3] {};
+    double upper[3] {};
+    double tolerance {};
+
+    facet_planes(const quickhull_engine& engine)
+    /*
+    Initialise instance of the facet_planes structure from a finished 3D hull
+
+    Parameters
+    ----------
+    engine : quickhull_engine
+        engine on which build() has been called, with dimension 3
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        for (int f : engine.hull_facets())
+        {
+            nx.push_back(engine.pool.normals[f * 3]);
+            ny.push_back(engine.pool.normals[f * 3 + 1]);
+            nz.push_back(engine.pool.normals[f * 3 + 2]);
+            offset.push_back(engine.pool.offsets[f]);
+        }
+        for (int j = 0; j < 3; j++)
+        {
+            lower[j] = std::numeric_limits<double>::infinity();
+            upper[j] = -std::numeric_limits<double>::infinity();
+        }
+        for (int p : engine.hull_vertices())
+        {
+            for (int j = 0; j < 3; j++)
+            {
+                lower[j] = std::min(lower[j], engine.coords[p * 3 + j]);
+                upper[j] = std::max(upper[j], engine.coords[p * 3 + j]);
+            }
+        }
+        tolerance = engine.tolerance;
+    }
+
+    bool contains(double x, double y, double z) const
+    /*
+    Test whether a point lies inside (or on) the hull.
+    Facets are tested in blocks so that a point outside can stop after the first block with a positive distance.
+
+    Parameters
+    ----------
+    x, y, z : double
+        coordinates of the query point
+
+    Returns
+    -------
+    inside : bool
+        True if the point is inside the hull or on its boundary; False if a coordinate is NaN
+    */
+
+    {
+        // coarse bounding-volume check, written so that NaN coordinates fail it
+        if (!(x >= lower[0] - tolerance && x <= upper[0] + tolerance &&
+              y >= lower[1] - tolerance && y <= upper[1] + tolerance &&
+              z >= lower[2] - tolerance && z <= upper[2] + tolerance))
+        {
+            return false;
+        }
+
+        const int block {16};
+        int n_facets {(int) offset.size()};
+        const double* a {nx.data()};
+        const double* b {ny.data()};
+        const double* c {nz.data()};
+        const double* d {offset.data()};
+        for (int start = 0; start < n_facets; start += block)
+        {
+            int end {std::min(start + block, n_facets)};
+            double furthest {-std::numeric_limits<double>::infinity()};
+            #pragma omp simd reduction(max:furthest)
+            for (int f = start; f < end; f++)
+            {
+                furthest = std::max(furthest, a[f] * x + b[f] * y + c[f] * z - d[f]);
+            }
+            if (furthest > tolerance)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// [[Rcpp::export]]
+List convex_hull_3d(NumericMatrix points, bool store_facets = true)
+/*
+Find the convex hull of points in three dimensions, with its volume, surface area and facet normals (for R package build).
+
+Facet areas and volumes are summed in parallel over the facets: each facet contributes ...
+... the cone from an interior point of the hull, with height (offset - normal . interior).
+
+Parameters
+----------
+points : NumericMatrix
+    n x 3 matrix, one point per row
+store_facets : bool
+    if false, only the summaries are returned. The hull and its facets are still found, since the summaries ...
+    ... are sums over facets; only the facet and normal matrices are not built.
+
+Returns
+-------
+hull : List
+    volume : double
+        volume enclosed by the hull
+    area : double
+        surface area of the hull
+    n_facets : int
+        number of triangular facets
+    facets : IntegerMatrix
+        only if store_facets. One facet per row, given by three rows of points (1-based)
+    normals : NumericMatrix
+        only if store_facets. Unit outward normal of each facet
+*/
+
+{
+    int n {points.nrow()};
+    if (points.ncol() != 3)
+    {
+        stop("points must have three columns");
+    }
+
+    // copy into row-major order so each point is contiguous
+    std::vector<double> coords (n * 3);
+    for (int j = 0; j < 3; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            coords[i * 3 + j] = points(i, j);
+        }
+    }
+
+    // find hull
+    quickhull_engine engine(coords.data(), n, 3);
+    engine.build();
+    std::vector<int> facets {engine.hull_facets()};
+    int n_facets {(int) facets.size()};
+
+    // volume and area
+    const std::vector<int>& vertices {engine.pool.vertices};
+    const std::vector<double>& normals {engine.pool.normals};
+    const std::vector<double>& offsets {engine.pool.offsets};
+    const std::vector<double>& interior {engine.interior};
+    double volume {0};
+    double area {0};
+    #pragma omp parallel for reduction(+:volume, area) schedule(static)
+    for (int r = 0; r < n_facets; r++)
+    {
+        int f {facets[r]};
+        const double* p0 {&coords[vertices[f * 3] * 3]};
+        const double* p1 {&coords[vertices[f * 3 + 1] * 3]};
+        const double* p2 {&coords[vertices[f * 3 + 2] * 3]};
+        double a[3] {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+        double b[3] {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+        double cx {a[1] * b[2] - a[2] * b[1]};
+        double cy {a[2] * b[0] - a[0] * b[2]};
+        double cz {a[0] * b[1] - a[1] * b[0]};
+        double facet_area {0.5 * std::sqrt(cx * cx + cy * cy + cz * cz)};
+        double height {offsets[f] - (normals[f * 3] * interior[0] + normals[f * 3 + 1] * interior[1] + normals[f * 3 + 2] * interior[2])};
+        area += facet_area;
+        volume += facet_area * height / 3;
+    }
+
+    // output
+    if (store_facets == false)
+    {
+        return List::create(Named("volume") = volume,
+                            Named("area") = area,
+                            Named("n_facets") = n_facets);
+    }
+
+    IntegerMatrix facet_vertices(n_facets, 3);
+    NumericMatrix facet_normals(n_facets, 3);
+    for (int r = 0; r < n_facets; r++)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            facet_vertices(r, i) = vertices[facets[r] * 3 + i] + 1;
+            facet_normals(r, i) = normals[facets[r] * 3 + i];
+        }
+    }
+    return List::create(Named("volume") = volume,
+                        Named("area") = area,
+                        Named("n_facets") = n_facets,
+                        Named("facets") = facet_vertices,
+                        Named("normals") = facet_normals);
+}
+
+// [[Rcpp::export]]
+LogicalVector points_in_hull_3d(NumericMatrix points, NumericMatrix query)
+/*
+Classify query points as inside or outside the convex hull of points in three dimensions (for R package build).
+
+The query matrix is read in place, column by column, and the points are classified in parallel.
+
+Parameters
+----------
+points : NumericMatrix
+    n x 3 matrix of the points whose hull is used
+query : NumericMatrix
+    m x 3 matrix of the points to classify
+
+Returns
+-------
+inside : LogicalVector
+    True for each query point inside the hull or on its boundary, NA if it has a non-finite coordinate
+*/
+
+{
+    int n {points.nrow()};
+    int m {query.nrow()};
+    if (points.ncol() != 3 || query.ncol() != 3)
+    {
+        stop("points and query must have three columns");
+    }
+
+    // copy into row-major order so each point is contiguous
+    std::vector<double> coords (n * 3);
+    for (int j = 0; j < 3; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            coords[i * 3 + j] = points(i, j);
+        }
+    }
+
+    // find hull
+    quickhull_engine engine(coords.data(), n, 3);
+    engine.build();
+    facet_planes planes(engine);
+
+    // classify
+    const double* qx {query.begin()};
+    const double* qy {qx + m};
+    const double* qz {qy + m};
+    LogicalVector inside(m);
+    int* result {inside.begin()};
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < m; i++)
+    {
+        if (!is_finite_point(qx[i], qy[i], qz[i]))
+        {
+            result[i] = NA_LOGICAL;
+        }
+        else
+        {
+            result[i] = planes.contains(qx[i], qy[i], qz[i]);
+        }
+    }
+    return inside;
+}
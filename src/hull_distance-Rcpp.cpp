@@ -0,0 +1,202 @@
+#include <vector>
+#include <algorithm>
+
+#include "geometry.h"
+#include "convex_polygon.h"
+#include "groups.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+struct hull_comparison
+/*
+A structure to hold the measures of difference between two convex hulls
+
+Attributes
+----------
+intersection_area : double
+    area common to both hulls
+symmetric_difference : double
+    area covered by exactly one of the hulls
+hausdorff : double
+    Hausdorff distance between the hulls
+
+Methods
+-------
+None
+*/
+{
+    double intersection_area {};
+    double symmetric_difference {};
+    double hausdorff {};
+};
+
+double directed_hausdorff(const convex_polygon& from, const convex_polygon& to)
+/*
+Directed Hausdorff distance, the furthest any point of one hull lies from the other.
+Distance to a convex set is a convex function, so the furthest point is a vertex.
+
+Parameters
+----------
+from : convex_polygon
+    hull whose points are measured
+to : convex_polygon
+    hull measured to
+
+Returns
+-------
+distance : double
+*/
+
+{
+    double furthest {0};
+    for (int i = 0; i < from.size(); i++)
+    {
+        furthest = std::max(furthest, to.distance(from.x[i], from.y[i]));
+    }
+    return furthest;
+}
+
+hull_comparison compare_hulls(const convex_polygon& a, const convex_polygon& b)
+/*
+Compare two convex hulls. The intersection costs O(h1 + h2); each vertex distance costs O(log h) ...
+... plus the length of the chain of edges visible from the vertex.
+
+Parameters
+----------
+a, b : convex_polygon
+    the hulls
+
+Returns
+-------
+comparison : hull_comparison
+*/
+
+{
+    hull_comparison comparison {};
+    comparison.intersection_area = intersect_polygons(a, b).area();
+    comparison.symmetric_difference = std::max(0.0, a.area() + b.area() - 2 * comparison.intersection_area);
+    comparison.hausdorff = std::max(directed_hausdorff(a, b), directed_hausdorff(b, a));
+    return comparison;
+}
+
+convex_polygon read_polygon(const double* x, const double* y, int start, int end)
+/*
+Read the vertices of a hull from coordinate vectors
+
+Parameters
+----------
+x, y : const double*
+    coordinate vectors
+start, end : int
+    the hull occupies rows start to end - 1
+
+Returns
+-------
+polygon : convex_polygon
+*/
+
+{
+    std::vector<point> hull {};
+    for (int i = start; i < end; i++)
+    {
+        hull.push_back(point(x[i], y[i]));
+    }
+    return convex_polygon(hull);
+}
+
+// [[Rcpp::export]]
+NumericVector hull_difference(NumericVector x1, NumericVector y1, NumericVector x2, NumericVector y2)
+/*
+Measure how far apart two convex hulls are (for R package build).
+Hulls in canonical form, as returned by the hull engines, are compared in O(h1 + h2) apart from the ...
+... Hausdorff distance; hulls given in another order are first sorted, in O(h log h).
+
+Parameters
+----------
+x1, y1 : NumericVector
+    coordinates of the vertices of the first hull, in any order
+x2, y2 : NumericVector
+    coordinates of the vertices of the second hull, in any order
+
+Returns
+-------
+difference : NumericVector
+    intersection_area, symmetric_difference and hausdorff
+*/
+
+{
+    if (x1.size() != y1.size() || x2.size() != y2.size())
+    {
+        stop("x and y coordinates must have the same length");
+    }
+    convex_polygon a {read_polygon(x1.begin(), y1.begin(), 0, x1.size())};
+    convex_polygon b {read_polygon(x2.begin(), y2.begin(), 0, x2.size())};
+    hull_comparison comparison {compare_hulls(a, b)};
+    return NumericVector::create(Named("intersection_area") = comparison.intersection_area,
+                                 Named("symmetric_difference") = comparison.symmetric_difference,
+                                 Named("hausdorff") = comparison.hausdorff);
+}
+
+// [[Rcpp::export]]
+List hull_difference_grouped(NumericVector x, NumericVector y, IntegerVector group)
+/*
+Measure how far each hull in a grouped result lies from the one before it (for R package build).
+Pairs of successive hulls are compared in parallel.
+
+Parameters
+----------
+x, y : NumericVector
+    coordinates of the hull vertices
+group : IntegerVector
+    hull each vertex belongs to; the vertices of each hull must be in consecutive rows
+
+Returns
+-------
+difference : List
+    from, to : IntegerVector
+        group values of the two hulls compared
+    intersection_area, symmetric_difference, hausdorff : NumericVector
+        as for hull_difference
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n || group.size() != n)
+    {
+        stop("x, y and group must have the same length");
+    }
+    std::vector<int> starts {find_group_starts(group.begin(), n)};
+    int n_pairs {std::max(0, (int) starts.size() - 2)};
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    std::vector<hull_comparison> comparisons (n_pairs);
+    #pragma omp parallel for schedule(dynamic)
+    for (int g = 0; g < n_pairs; g++)
+    {
+        convex_polygon a {read_polygon(px, py, starts[g], starts[g + 1])};
+        convex_polygon b {read_polygon(px, py, starts[g + 1], starts[g + 2])};
+        comparisons[g] = compare_hulls(a, b);
+    }
+
+    // output
+    IntegerVector from(n_pairs);
+    IntegerVector to(n_pairs);
+    NumericVector intersection_area(n_pairs);
+    NumericVector symmetric_difference(n_pairs);
+    NumericVector hausdorff(n_pairs);
+    for (int g = 0; g < n_pairs; g++)
+    {
+        from[g] = group[starts[g]];
+        to[g] = group[starts[g + 1]];
+        intersection_area[g] = comparisons[g].intersection_area;
+        symmetric_difference[g] = comparisons[g].symmetric_difference;
+        hausdorff[g] = comparisons[g].hausdorff;
+    }
+    return List::create(Named("from") = from,
+                        Named("to") = to,
+                        Named("intersection_area") = intersection_area,
+                        Named("symmetric_difference") = symmetric_difference,
+                        Named("hausdorff") = hausdorff);
+}
@@ -0,0 +1,75 @@
+#include <vector>
+
+#include "monotone_chain.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+List hull_layers(NumericVector x, NumericVector y)
+/*
+Peel a point set into convex layers and summarise each layer (for R package build).
+Layer 1 is every point on the boundary of the convex hull, layer 2 every point on the boundary of the ...
+... hull of the rest, and so on. The points are sorted once; after each layer the sorted order is ...
+... compacted to the points left, so each layer costs a few linear passes over the points remaining.
+
+Parameters
+----------
+x : NumericVector
+    x coords
+y : NumericVector
+    y coords
+
+Returns
+-------
+layers : List
+    layer : IntegerVector
+        layer of each point, numbered from 1 at the outside
+    count : IntegerVector
+        number of points in each layer
+    area : NumericVector
+        area of the hull bounding each layer
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n)
+    {
+        stop("x and y must have the same length");
+    }
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    std::vector<int> remaining {sort_points(px, py, n)};
+    IntegerVector layer(n);
+    std::vector<int> count {};
+    std::vector<double> area {};
+
+    while (!remaining.empty())
+    {
+        int l {(int) count.size() + 1};
+        std::vector<int> boundary {hull_boundary(px, py, remaining)};
+        for (int i : boundary)
+        {
+            layer[i] = l;
+        }
+        count.push_back((int) boundary.size());
+        area.push_back(hull_area(px, py, monotone_chain(px, py, remaining)));
+
+        // keep the sorted order of the points left
+        std::vector<int> left {};
+        left.reserve(remaining.size() - boundary.size());
+        for (int i : remaining)
+        {
+            if (layer[i] == 0)
+            {
+                left.push_back(i);
+            }
+        }
+        remaining.swap(left);
+    }
+
+    return List::create(Named("layer") = layer,
+                        Named("count") = count,
+                        Named("area") = area);
+}
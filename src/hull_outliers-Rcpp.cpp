@@ -0,0 +1,225 @@
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "geometry.h"
+#include "monotone_chain.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+bool in_triangle(const point& a, const point& b, const point& c, const point& p)
+/*
+Tests whether a point lies inside or on a counterclockwise triangle
+
+Parameters
+----------
+a, b, c : point
+    corners of the triangle, counterclockwise
+p : point
+    the point
+
+Returns
+-------
+inside : bool
+*/
+
+{
+    return orientation(a, b, p) >= 0 && orientation(b, c, p) >= 0 && orientation(c, a, p) >= 0;
+}
+
+std::vector<double> removal_scores(const double* x, const double* y, const std::vector<int>& hull,
+                                   const std::vector<int>& order, const std::vector<char>& alive)
+/*
+Finds how much the hull area shrinks when each hull vertex is removed.
+
+Removing vertex v only changes the hull inside the triangle (previous vertex, v, next vertex), the cap of v. ...
+... The new hull replaces v by the hull of the points in the cap, so the shrinkage is the area of the cap ...
+... less the area of the hull of the points inside it.
+Each point is located in O(log h) among the sectors around an interior point; a cap which does not ...
+... contain that interior point lies within the two sectors either side of its vertex.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+hull : vector<int>
+    indices of the hull vertices, counterclockwise, at least three of them
+order : vector<int>
+    indices of all points in sorted order, from sort_points
+alive : vector<char>
+    1 for points still in the set
+
+Returns
+-------
+scores : vector<double>
+    area lost by removing each hull vertex
+*/
+
+{
+    int h {(int) hull.size()};
+    std::vector<point> vertex {};
+    double cx {0};
+    double cy {0};
+    for (int v : hull)
+    {
+        vertex.push_back(point(x[v], y[v]));
+        cx += x[v] / h;
+        cy += y[v] / h;
+    }
+    point centre(cx, cy);
+
+    // sector s lies between the rays from the centre through vertices s and s+1
+    std::vector<double> ray_angle (h);
+    for (int i = 0; i < h; i++)
+    {
+        ray_angle[i] = std::atan2(vertex[i].y - cy, vertex[i].x - cx);
+    }
+    int first_ray {(int) (std::min_element(ray_angle.begin(), ray_angle.end()) - ray_angle.begin())};
+    std::vector<double> sorted_angle (h);
+    for (int i = 0; i < h; i++)
+    {
+        sorted_angle[i] = ray_angle[(first_ray + i) % h];
+    }
+
+    // caps containing the centre cannot be narrowed down by sector
+    std::vector<int> wide_caps {};
+    for (int i = 0; i < h; i++)
+    {
+        if (orientation(vertex[(i + h - 1) % h], vertex[(i + 1) % h], centre) <= 0)
+        {
+            wide_caps.push_back(i);
+        }
+    }
+
+    std::vector<char> on_hull (alive.size(), 0);
+    for (int v : hull)
+    {
+        on_hull[v] = 1;
+    }
+
+    // gather the points in each cap
+    std::vector<std::vector<int> > cap_points (h);
+    for (int p : order)
+    {
+        if (alive[p] == 0 || on_hull[p] == 1)
+        {
+            continue;
+        }
+        point q(x[p], y[p]);
+        double angle {std::atan2(q.y - cy, q.x - cx)};
+        int rank {(int) (std::upper_bound(sorted_angle.begin(), sorted_angle.end(), angle) - sorted_angle.begin())};
+        int sector {(first_ray + rank - 1 + h) % h};
+        int candidates[2] {sector, (sector + 1) % h};
+        for (int i : candidates)
+        {
+            if (in_triangle(vertex[(i + h - 1) % h], vertex[i], vertex[(i + 1) % h], q))
+            {
+                cap_points[i].push_back(p);
+            }
+        }
+        for (int i : wide_caps)
+        {
+            if (i != candidates[0] && i != candidates[1] && in_triangle(vertex[(i + h - 1) % h], vertex[i], vertex[(i + 1) % h], q))
+            {
+                cap_points[i].push_back(p);
+            }
+        }
+    }
+
+    // shrinkage of each cap
+    std::vector<double> scores (h);
+    for (int i = 0; i < h; i++)
+    {
+        int previous {hull[(i + h - 1) % h]};
+        int next {hull[(i + 1) % h]};
+        std::vector<int> cap {cap_points[i]};
+        cap.push_back(previous);
+        cap.push_back(next);
+        std::sort(cap.begin(), cap.end(), [x, y](int a, int b)
+        {
+            if (x[a] != x[b]) return x[a] < x[b];
+            if (y[a] != y[b]) return y[a] < y[b];
+            return a < b;
+        });
+        std::vector<int> cap_triangle {previous, hull[i], next};
+        scores[i] = std::max(0.0, hull_area(x, y, cap_triangle) - hull_area(x, y, monotone_chain(x, y, cap)));
+    }
+    return scores;
+}
+
+// [[Rcpp::export]]
+List hull_outlier_scores(NumericVector x, NumericVector y, int k = 1)
+/*
+Score points by how much their removal shrinks the area of the convex hull (for R package build).
+
+Only hull vertices can shrink the hull, so all other points score zero. After scoring, the whole ...
+... boundary of the layer is peeled off (vertices, points in the interior of hull edges and repeats ...
+... of these, as in hull_layers) and the next layer is scored, for k layers. The sort order is kept ...
+... between layers, so each new hull is a single monotone chain pass.
+
+Parameters
+----------
+x : NumericVector
+    x coords
+y : NumericVector
+    y coords
+k : int
+    number of layers to score
+
+Returns
+-------
+scores : List
+    score : NumericVector
+        area lost by removing each point from its layer
+    layer : IntegerVector
+        layer each point was scored in, 0 if it lies deeper than k layers
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n)
+    {
+        stop("x and y must have the same length");
+    }
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    std::vector<int> order {sort_points(px, py, n)};
+    std::vector<char> alive (n, 1);
+    NumericVector score(n);
+    IntegerVector layer(n);
+
+    for (int l = 1; l <= k; l++)
+    {
+        std::vector<int> hull {monotone_chain(px, py, order, alive)};
+        if (hull.empty())
+        {
+            break;
+        }
+        if (hull.size() >= 3)
+        {
+            std::vector<double> scores {removal_scores(px, py, hull, order, alive)};
+            for (size_t i = 0; i < hull.size(); i++)
+            {
+                score[hull[i]] = scores[i];
+            }
+        }
+        std::vector<int> remaining {};
+        for (int i : order)
+        {
+            if (alive[i] == 1)
+            {
+                remaining.push_back(i);
+            }
+        }
+        for (int v : hull_boundary(px, py, remaining))
+        {
+            layer[v] = l;
+            alive[v] = 0;
+        }
+    }
+
+    return List::create(Named("score") = score,
+                        Named("layer") = layer);
+}
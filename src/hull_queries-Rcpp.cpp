@@ -0,0 +1,300 @@
+#include <vector>
+#include <algorithm>
+
+#include "geometry.h"
+#include "convex_polygon.h"
+#include "groups.h"
+#include "coordinate_scan.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+convex_polygon read_hull(NumericVector hx, NumericVector hy)
+/*
+Read the vertices of a hull from R vectors into a convex polygon
+
+Parameters
+----------
+hx, hy : NumericVector
+    coordinates of the hull vertices, in any order
+
+Returns
+-------
+polygon : convex_polygon
+*/
+
+{
+    if (hx.size() != hy.size())
+    {
+        stop("hull x and y coordinates must have the same length");
+    }
+    std::vector<point> hull {};
+    for (int i = 0; i < hx.size(); i++)
+    {
+        hull.push_back(point(hx[i], hy[i]));
+    }
+    return convex_polygon(hull);
+}
+
+// [[Rcpp::export]]
+List hull_tangents(NumericVector hx, NumericVector hy, NumericVector qx, NumericVector qy)
+/*
+Find the tangents to a convex hull from each of a batch of query points (for R package build).
+Each query costs O(log h); queries are answered in parallel.
+
+Parameters
+----------
+hx, hy : NumericVector
+    coordinates of the hull vertices, e.g. from find_convex_hull
+qx, qy : NumericVector
+    coordinates of the query points
+
+Returns
+-------
+tangents : List
+    left : IntegerVector
+        position in hx, hy of the vertex touched by the left tangent, with the hull to the right of the ...
+        ... ray from the query point through it. NA for query points inside the hull.
+    right : IntegerVector
+        likewise for the right tangent, with the hull to the left of the ray
+*/
+
+{
+    convex_polygon polygon {read_hull(hx, hy)};
+    int m {(int) qx.size()};
+    if (qy.size() != m)
+    {
+        stop("query x and y coordinates must have the same length");
+    }
+
+    const double* px {qx.begin()};
+    const double* py {qy.begin()};
+    IntegerVector left(m);
+    IntegerVector right(m);
+    int* left_out {left.begin()};
+    int* right_out {right.begin()};
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < m; i++)
+    {
+        int l {};
+        int r {};
+        if (polygon.tangents(px[i], py[i], l, r))
+        {
+            left_out[i] = polygon.index[l] + 1;
+            right_out[i] = polygon.index[r] + 1;
+        }
+        else
+        {
+            left_out[i] = NA_INTEGER;
+            right_out[i] = NA_INTEGER;
+        }
+    }
+    return List::create(Named("left") = left,
+                        Named("right") = right);
+}
+
+// [[Rcpp::export]]
+List hull_line_intersections(NumericVector hx, NumericVector hy, NumericVector px, NumericVector py,
+                             NumericVector dx, NumericVector dy, bool ray = false)
+/*
+Clip a batch of lines or rays to a convex hull (for R package build).
+Each query costs O(log h); queries are answered in parallel.
+
+Parameters
+----------
+hx, hy : NumericVector
+    coordinates of the hull vertices, e.g. from find_convex_hull
+px, py : NumericVector
+    a point on each line, or the origin of each ray
+dx, dy : NumericVector
+    direction of each line or ray
+ray : bool
+    if true, only the part of each line with t >= 0 is used
+
+Returns
+-------
+intersections : List
+    hit : LogicalVector
+        True if the line or ray meets the hull. NA for queries with a non-finite coordinate or a zero direction.
+    t_enter, t_exit : NumericVector
+        the part of each line inside the hull is p + t d for t_enter <= t <= t_exit. NA for misses and NA queries.
+*/
+
+{
+    convex_polygon polygon {read_hull(hx, hy)};
+    int m {(int) px.size()};
+    if (py.size() != m || dx.size() != m || dy.size() != m)
+    {
+        stop("px, py, dx and dy must have the same length");
+    }
+
+    const double* ox {px.begin()};
+    const double* oy {py.begin()};
+    const double* ux {dx.begin()};
+    const double* uy {dy.begin()};
+    LogicalVector hit(m);
+    NumericVector t_enter(m);
+    NumericVector t_exit(m);
+    int* hit_out {hit.begin()};
+    double* enter_out {t_enter.begin()};
+    double* exit_out {t_exit.begin()};
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < m; i++)
+    {
+        if (!is_finite_point(ox[i], oy[i]) || !is_finite_point(ux[i], uy[i]) || (ux[i] == 0 && uy[i] == 0))
+        {
+            hit_out[i] = NA_LOGICAL;
+            enter_out[i] = NA_REAL;
+            exit_out[i] = NA_REAL;
+            continue;
+        }
+        double enter {};
+        double exit {};
+        bool meets {polygon.line_intersection(ox[i], oy[i], ux[i], uy[i], enter, exit)};
+        if (meets && ray)
+        {
+            meets = exit >= 0;
+            enter = std::max(enter, 0.0);
+        }
+        hit_out[i] = meets;
+        enter_out[i] = meets ? enter : NA_REAL;
+        exit_out[i] = meets ? exit : NA_REAL;
+    }
+    return List::create(Named("hit") = hit,
+                        Named("t_enter") = t_enter,
+                        Named("t_exit") = t_exit);
+}
+
+// [[Rcpp::export]]
+LogicalVector points_in_hull(NumericVector hx, NumericVector hy, NumericVector x, NumericVector y)
+/*
+Filter a point set to the inside of a convex hull (for R package build).
+Points are read in place; each is tested against every edge in one vectorised loop, ...
+... and points are tested in parallel.
+
+Parameters
+----------
+hx, hy : NumericVector
+    coordinates of the hull vertices, e.g. from find_convex_hull
+x, y : NumericVector
+    coordinates of the points
+
+Returns
+-------
+inside : LogicalVector
+    True for points inside or on the hull, NA for points with a non-finite coordinate
+*/
+
+{
+    edge_planes planes {read_hull(hx, hy)};
+    int n {(int) x.size()};
+    if (y.size() != n)
+    {
+        stop("x and y must have the same length");
+    }
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    LogicalVector inside(n);
+    int* inside_out {inside.begin()};
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < n; i++)
+    {
+        inside_out[i] = is_finite_point(px[i], py[i]) ? planes.contains(px[i], py[i]) : NA_LOGICAL;
+    }
+    return inside;
+}
+
+// [[Rcpp::export]]
+List clip_polylines(NumericVector hx, NumericVector hy, NumericVector x, NumericVector y, IntegerVector line)
+/*
+Clip polylines to a convex hull with the Cyrus-Beck algorithm (for R package build).
+Segments are clipped in parallel, then joined back into pieces: a piece runs on while ...
+... consecutive segments stay inside the hull, and a new piece starts where the polyline re-enters it.
+Segments with a vertex having a non-finite coordinate are dropped, so a polyline is broken at such vertices.
+
+Parameters
+----------
+hx, hy : NumericVector
+    coordinates of the hull vertices, e.g. from find_convex_hull
+x, y : NumericVector
+    coordinates of the polyline vertices
+line : IntegerVector
+    polyline of each vertex. A polyline is a run of consecutive vertices with the same value.
+
+Returns
+-------
+clipped : List
+    x, y : NumericVector
+        coordinates of the vertices of the clipped pieces
+    piece : IntegerVector
+        piece of each vertex, numbered from 1
+    line : IntegerVector
+        polyline of each vertex
+*/
+
+{
+    edge_planes planes {read_hull(hx, hy)};
+    int n {(int) x.size()};
+    if (y.size() != n || line.size() != n)
+    {
+        stop("x, y and line must have the same length");
+    }
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    const int* pl {line.begin()};
+
+    // clip each segment, i.e. each vertex with the next one
+    std::vector<char> hit (n, 0);
+    std::vector<double> t_enter (n);
+    std::vector<double> t_exit (n);
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < n - 1; i++)
+    {
+        if (pl[i] == pl[i + 1] && is_finite_point(px[i], py[i]) && is_finite_point(px[i + 1], py[i + 1]))
+        {
+            hit[i] = planes.clip_segment(px[i], py[i], px[i + 1], py[i + 1], t_enter[i], t_exit[i]);
+        }
+    }
+
+    // join the clipped segments into pieces
+    std::vector<double> out_x {};
+    std::vector<double> out_y {};
+    std::vector<int> out_piece {};
+    std::vector<int> out_line {};
+    std::vector<int> starts {find_group_starts(pl, n)};
+    int pieces {0};
+    for (size_t g = 0; g + 1 < starts.size(); g++)
+    {
+        bool open {false};
+        for (int i = starts[g]; i < starts[g + 1] - 1; i++)
+        {
+            if (hit[i] == 0)
+            {
+                open = false;
+                continue;
+            }
+            double dx {px[i + 1] - px[i]};
+            double dy {py[i + 1] - py[i]};
+            if (!open || t_enter[i] > 0)
+            {
+                pieces++;
+                out_x.push_back(px[i] + t_enter[i] * dx);
+                out_y.push_back(py[i] + t_enter[i] * dy);
+                out_piece.push_back(pieces);
+                out_line.push_back(pl[i]);
+            }
+            out_x.push_back(t_exit[i] == 1 ? px[i + 1] : px[i] + t_exit[i] * dx);
+            out_y.push_back(t_exit[i] == 1 ? py[i + 1] : py[i] + t_exit[i] * dy);
+            out_piece.push_back(pieces);
+            out_line.push_back(pl[i]);
+            open = t_exit[i] == 1;
+        }
+    }
+
+    return List::create(Named("x") = out_x,
+                        Named("y") = out_y,
+                        Named("piece") = out_piece,
+                        Named("line") = out_line);
+}
@@ -0,0 +1,156 @@
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+#include "geometry.h"
+#include "convex_polygon.h"
+#include "random.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+std::vector<double> fan_areas(const convex_polygon& polygon)
+/*
+Cumulative areas of the fan triangulation of a convex polygon, ...
+... whose triangle i has corners 0, i + 1 and i + 2
+
+Parameters
+----------
+polygon : convex_polygon
+    polygon with at least three vertices
+
+Returns
+-------
+cumulative : vector<double>
+    total area of triangles 0 to i
+*/
+
+{
+    std::vector<double> cumulative {};
+    double total {0};
+    for (int i = 1; i + 1 < polygon.size(); i++)
+    {
+        total += cross_product(polygon.x[0], polygon.y[0], polygon.x[i], polygon.y[i], polygon.x[i + 1], polygon.y[i + 1]) / 2;
+        cumulative.push_back(total);
+    }
+    return cumulative;
+}
+
+// [[Rcpp::export]]
+List triangulate_hull(NumericVector hx, NumericVector hy)
+/*
+Triangulate a convex hull as a fan from its first vertex (for R package build).
+
+Parameters
+----------
+hx, hy : NumericVector
+    coordinates of the hull vertices, e.g. from find_convex_hull
+
+Returns
+-------
+triangulation : List
+    triangles : IntegerMatrix
+        one triangle per row, given by the positions of its corners in hx, hy, counterclockwise
+    area : NumericVector
+        area of each triangle
+*/
+
+{
+    if (hx.size() != hy.size())
+    {
+        stop("hull x and y coordinates must have the same length");
+    }
+    std::vector<point> hull {};
+    for (int i = 0; i < hx.size(); i++)
+    {
+        hull.push_back(point(hx[i], hy[i]));
+    }
+    convex_polygon polygon {hull};
+    std::vector<double> cumulative {fan_areas(polygon)};
+
+    int n_triangles {(int) cumulative.size()};
+    IntegerMatrix triangles(n_triangles, 3);
+    NumericVector area(n_triangles);
+    for (int t = 0; t < n_triangles; t++)
+    {
+        triangles(t, 0) = polygon.index[0] + 1;
+        triangles(t, 1) = polygon.index[t + 1] + 1;
+        triangles(t, 2) = polygon.index[t + 2] + 1;
+        area[t] = cumulative[t] - (t > 0 ? cumulative[t - 1] : 0);
+    }
+    return List::create(Named("triangles") = triangles,
+                        Named("area") = area);
+}
+
+// [[Rcpp::export]]
+NumericMatrix sample_in_hull(NumericVector hx, NumericVector hy, int n)
+/*
+Draw points uniformly at random inside a convex hull (for R package build).
+A triangle of the fan triangulation is chosen with probability proportional to its area, then a point ...
+... is drawn uniformly inside it, so no draws are rejected. Blocks of samples are drawn in parallel, each ...
+... from its own random stream seeded from R, so results follow set.seed whatever the number of threads.
+
+Parameters
+----------
+hx, hy : NumericVector
+    coordinates of the hull vertices, e.g. from find_convex_hull
+n : int
+    number of points to draw
+
+Returns
+-------
+samples : NumericMatrix
+    n x 2 matrix of coordinates
+*/
+
+{
+    if (hx.size() != hy.size())
+    {
+        stop("hull x and y coordinates must have the same length");
+    }
+    if (n < 0)
+    {
+        stop("n must not be negative");
+    }
+    std::vector<point> hull {};
+    for (int i = 0; i < hx.size(); i++)
+    {
+        hull.push_back(point(hx[i], hy[i]));
+    }
+    convex_polygon polygon {hull};
+    if (polygon.size() < 3)
+    {
+        stop("hull must enclose a positive area");
+    }
+    std::vector<double> cumulative {fan_areas(polygon)};
+    double total {cumulative.back()};
+
+    uint64_t seed {(uint64_t) (R::unif_rand() * 4294967296.0) << 32 | (uint64_t) (R::unif_rand() * 4294967296.0)};
+    const int block {4096};
+    int n_blocks {(n + block - 1) / block};
+    NumericMatrix samples(n, 2);
+    double* sx {samples.begin()};
+    double* sy {samples.begin() + n};
+    #pragma omp parallel for schedule(static)
+    for (int b = 0; b < n_blocks; b++)
+    {
+        random_stream stream(seed, b);
+        for (int i = b * block; i < std::min(n, (b + 1) * block); i++)
+        {
+            double pick {stream.uniform() * total};
+            int t {(int) (std::upper_bound(cumulative.begin(), cumulative.end(), pick) - cumulative.begin())};
+            t = std::min(t, (int) cumulative.size() - 1);
+            // uniform in the parallelogram, folded back into the triangle
+            double u {stream.uniform()};
+            double v {stream.uniform()};
+            if (u + v > 1)
+            {
+                u = 1 - u;
+                v = 1 - v;
+            }
+            sx[i] = polygon.x[0] + u * (polygon.x[t + 1] - polygon.x[0]) + v * (polygon.x[t + 2] - polygon.x[0]);
+            sy[i] = polygon.y[0] + u * (polygon.y[t + 1] - polygon.y[0]) + v * (polygon.y[t + 2] - polygon.y[0]);
+        }
+    }
+    return samples;
+}
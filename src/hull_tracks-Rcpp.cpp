@@ -0,0 +1,159 @@
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "monotone_chain.h"
+#include "coordinate_scan.h"
+#include "groups.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+void track_hulls(const double* x, const double* y, const double* time, int start, int end,
+                 std::vector<double>& times, std::vector<std::vector<int> >& hulls, std::vector<double>& areas)
+/*
+Find the cumulative hulls of one object at each of its timestamps, by incremental insertion.
+The points of each timestamp are merged into the hull so far: the new hull is the hull of the old ...
+... vertices and the new points, so each step costs O((h + k) log(h + k)) for k new points, whatever the history.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+time : const double*
+    timestamp of each point
+start, end : int
+    the object occupies rows start to end - 1
+times : vector<double>&
+    set to the distinct timestamps of the object, in increasing order
+hulls : vector<vector<int> >&
+    set to the hull of all points up to and including each timestamp
+areas : vector<double>&
+    set to the area of each hull
+
+Returns
+-------
+None
+*/
+
+{
+    std::vector<int> rows (end - start);
+    for (int i = start; i < end; i++)
+    {
+        rows[i - start] = i;
+    }
+    std::stable_sort(rows.begin(), rows.end(), [time](int a, int b)
+    {
+        return time[a] < time[b];
+    });
+
+    std::vector<int> hull {};
+    int m {(int) rows.size()};
+    for (int i = 0; i < m; )
+    {
+        std::vector<int> ids {hull};
+        int j {i};
+        while (j < m && time[rows[j]] == time[rows[i]])
+        {
+            ids.push_back(rows[j++]);
+        }
+        sort_subset(x, y, ids);
+        hull = monotone_chain(x, y, ids);
+        times.push_back(time[rows[i]]);
+        hulls.push_back(hull);
+        areas.push_back(hull_area(x, y, hull));
+        i = j;
+    }
+}
+
+// [[Rcpp::export]]
+List hull_tracks(IntegerVector object, NumericVector time, NumericVector x, NumericVector y)
+/*
+Track the convex hulls of many objects through time (for R package build).
+For each object and each of its timestamps, finds the hull of all its points observed up to that time. ...
+... Objects are independent and are computed in parallel.
+
+Parameters
+----------
+object : IntegerVector
+    object of each point; an object is a run of consecutive rows with the same value
+time : NumericVector
+    timestamp of each point, in any order within an object
+x : NumericVector
+    x coords
+y : NumericVector
+    y coords
+
+Returns
+-------
+tracks : List
+    object : IntegerVector
+        object of each snapshot
+    time : NumericVector
+        timestamp of each snapshot, increasing within each object
+    area : NumericVector
+        area of the hull at each snapshot
+    snapshot : IntegerVector
+        snapshot each hull vertex belongs to, numbered from 1
+    index : IntegerVector
+        position of each hull vertex in x, y (1-based), counterclockwise within each snapshot
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n || time.size() != n || object.size() != n)
+    {
+        stop("object, time, x and y must have the same length");
+    }
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    const double* ptime {time.begin()};
+    if (scan_coordinates(px, py, n).non_finite > 0)
+    {
+        stop("x and y must be finite");
+    }
+    for (int i = 0; i < n; i++)
+    {
+        if (std::isnan(ptime[i]))
+        {
+            stop("time must not be NA");
+        }
+    }
+
+    std::vector<int> starts {find_group_starts(object.begin(), n)};
+    int groups {(int) starts.size() - 1};
+    std::vector<std::vector<double> > times (groups);
+    std::vector<std::vector<std::vector<int> > > hulls (groups);
+    std::vector<std::vector<double> > areas (groups);
+    #pragma omp parallel for schedule(dynamic)
+    for (int g = 0; g < groups; g++)
+    {
+        track_hulls(px, py, ptime, starts[g], starts[g + 1], times[g], hulls[g], areas[g]);
+    }
+
+    // output
+    std::vector<int> snapshot_object {};
+    std::vector<double> snapshot_time {};
+    std::vector<double> snapshot_area {};
+    std::vector<int> snapshot {};
+    std::vector<int> index {};
+    for (int g = 0; g < groups; g++)
+    {
+        for (size_t s = 0; s < times[g].size(); s++)
+        {
+            snapshot_object.push_back(object[starts[g]]);
+            snapshot_time.push_back(times[g][s]);
+            snapshot_area.push_back(areas[g][s]);
+            for (int v : hulls[g][s])
+            {
+                snapshot.push_back((int) snapshot_time.size());
+                index.push_back(v + 1);
+            }
+        }
+    }
+    return List::create(Named("object") = snapshot_object,
+                        Named("time") = snapshot_time,
+                        Named("area") = snapshot_area,
+                        Named("snapshot") = snapshot,
+                        Named("index") = index);
+}
@@ -0,0 +1,72 @@
+#include <vector>
+
+#include "geometry.h"
+#include "convex_polygon.h"
+#include "groups.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+List inscribed_circles(NumericVector x, NumericVector y, IntegerVector group)
+/*
+Find the largest circle inside the convex hull of each group of points (for R package build).
+Groups are processed in parallel, each in O(n log n).
+
+Parameters
+----------
+x, y : NumericVector
+    coordinates of the points
+group : IntegerVector
+    group of each point; the points of each group must be in consecutive rows
+
+Returns
+-------
+circles : List
+    group : IntegerVector
+        group value
+    x, y : NumericVector
+        centre of the circle
+    radius : NumericVector
+        radius of the circle, 0 if the points of the group are collinear
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n || group.size() != n)
+    {
+        stop("x, y and group must have the same length");
+    }
+    std::vector<int> starts {find_group_starts(group.begin(), n)};
+    int n_groups {(int) starts.size() - 1};
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    IntegerVector group_out(n_groups);
+    NumericVector cx(n_groups);
+    NumericVector cy(n_groups);
+    NumericVector radius(n_groups);
+    double* cx_out {cx.begin()};
+    double* cy_out {cy.begin()};
+    double* radius_out {radius.begin()};
+    #pragma omp parallel for schedule(dynamic)
+    for (int g = 0; g < n_groups; g++)
+    {
+        std::vector<point> points {};
+        for (int i = starts[g]; i < starts[g + 1]; i++)
+        {
+            points.push_back(point(px[i], py[i]));
+        }
+        convex_polygon hull {points};
+        radius_out[g] = hull.inscribed_circle(cx_out[g], cy_out[g]);
+    }
+    for (int g = 0; g < n_groups; g++)
+    {
+        group_out[g] = group[starts[g]];
+    }
+
+    return List::create(Named("group") = group_out,
+                        Named("x") = cx,
+                        Named("y") = cy,
+                        Named("radius") = radius);
+}
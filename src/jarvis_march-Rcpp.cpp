@@ -8,181 +8,14 @@
 #include <string>
 #include <cmath>
 
+#include "geometry.h"
+#include "canonical_hull.h"
+#include "coordinate_scan.h"
+#include "monotone_chain.h"
+
 #include<Rcpp.h>
 using namespace Rcpp;
 
-//[[Rcpp::export]]
-struct point
-/*
-A structure to represent a single point on a two-dimensional plane
-
-Attributes
-----------
-x : double
-    x-coordinate
-y : double
-    y-coordinate
-
-Methods
--------
-None
-*/    
-{  
-    double x;
-    double y;
-    
-    point(double _x,double _y)
-    /*
-    Initialise instance of the point structure
-
-    Parameters
-    ----------
-    _x : double
-        x-coordinate
-    _y : double
-        y-coordinate
-
-    Returns
-    -------
-    None
-    */
-        
-    {
-        x = _x;
-        y = _y;   
-    }
-};
-
-struct triplet_of_points
-/*
-A structure to represent a group of three points (one, two and three) on a two-dimensional plane
-
-Attributes
-----------
-right_turn : 
-    True if a traversal from point 1 to point 3 via point 2 involves a right turn.
-    I.e. if the counterclockwise angle between a and b is 180 degrees or less. 
-    If the traversal involves just a straight line, right_turn = True
-    If the traversal involves a 360 degree turn, right_turn = False
-collinearity : 
-    True if the three points are collinear. 
-a :
-    the dimensions of the line between the first and second point in the triplet
-b : 
-    the dimensions of the line between the third and second point in the triplet
-determinent : 
-    the determinent of matrix (a^T, b^T)
-    I.e. the cross product between a and b. 
-dot_product : 
-    the dot product of a and b
-
-Methods
--------
-find_orientation:
-    determines whether a traversal from point 1 to point 3 via point 2 involves a right turn. 
-*/    
-{  
-    bool right_turn {};
-    bool collinearity {};
-    double determinent {};
-    double dot_product {};
-    
-    triplet_of_points(point p1, point p2, point p3)
-    /*
-    Initialise instance of the triplet_of_points class
-
-    Parameters
-    ----------
-    p1 : point
-        First point in triplet
-    p2 : point
-        Second point in triplet
-    p3 : point
-        Third point in triplet
-    Returns
-    -------
-    None
-    */
-        
-    {
-        point a(p1.x - p2.x, p1.y - p2.y);
-        point b(p3.x - p2.x, p3.y - p2.y);
-        determinent = a.x * b.y - b.x * a.y;
-        dot_product = a.x * b.x + a.y * b.y ; 
-    }
-    
-    void find_orientation()
-    /*
-    Find the orientation (i.e. right-turning or not) of the triplet. 
-    Also identify if points on triplet are collinear 
-
-    Parameters
-    ----------
-    None
-    
-    Returns
-    -------
-    None
-    */
-      
-    {        
-        if (determinent > 0) // right turn
-        {
-            right_turn = true;
-            collinearity = false;
-        }
-        else if (determinent == 0 && dot_product < 0) // straight line, categorised as right turn
-        {
-            right_turn = true;
-            collinearity = true;
-        }
-        else if (determinent == 0 && dot_product > 0) // back on itselft, cateogorised as left turn
-        {
-            right_turn = false;
-            collinearity = true;
-        }
-        else if (determinent < 0) // left turn
-        {
-            right_turn = false;
-            collinearity = false;
-        }
-    }
-};
-
-int find_leftmost_point(double leftmost_val, std::vector<point> points)
-/*
-Finds the leftmost point in a set of points. 
-If there are two points on the left with same x value, this function will choose the one it encounters first.
-This is arbitrary but does not affect the outcome of the algorithm, only the ordering of points on the hull.
-
-Parameters
-----------
-leftmost_val : double
-    the current estimate of the x-value of the leftmost point. 
-points : vector<point>
-    vector of points which are being analysed
-
-Returns
--------
-leftmost_index_update : int
-    index (within the points vector) of the leftmost point. 
-*/  
-
-{    
-double leftmost_val_update {leftmost_val};
-int leftmost_index_update {};
-
-    for(int p = 0; p < points.size(); p++)
-    {
-        if (points[p].x < leftmost_val_update)
-        {
-            leftmost_val_update = points[p].x;
-            leftmost_index_update = p;            
-        }
-    }
-    return leftmost_index_update;
-};
-
 int find_new_point(std::vector<point> points, std::vector<int> exceptions)
 /*
 Finds the index of a new point at random from a vector of points
@@ -214,7 +47,7 @@ new_point : int
     return new_point;
 };
 
-std::vector<point> find_convex_hull(std::vector<point> points)
+std::vector<point> find_convex_hull(std::vector<point> points, int leftmost_index)
 /*
 Finds the convex hull of a vector of points. 
 First this function deals with indices: i.e. it finds the indices of the points in the vector which are on the hull. 
@@ -224,6 +57,9 @@ Parameters
 ----------
 points : vector<point>
     vector of points being analysed
+leftmost_index : int
+    index (within the points vector) of the leftmost point, taking the lowest of these if there are ties, ...
+    ... e.g. from scan_coordinates. The march starts from it, as it is a corner of the hull.
 
 Returns
 -------
@@ -236,9 +72,7 @@ convex_hull_points : vector<point>
     std::vector<int> convex_hull {}; // list of indices indicating list-position of the points on the hull
     std::vector<point> convex_hull_points {}; // list of points (from the points class) on the convex hull
     bool all_points_collinear {true}; // change this if we find non-collinear points
-    int leftmost_index;
     int rightmost_index;
-    double leftmost_val {std::numeric_limits<double>::infinity()};
     
     // First deal with special cases of small sets of points
     if (points.size() == 0){
@@ -251,7 +85,6 @@ convex_hull_points : vector<point>
     else if (points.size() == 2){
         std::cout << "only two data points to analyse" << std::endl;
         // add leftmost point
-        leftmost_index = find_leftmost_point(leftmost_val, points);
         convex_hull.push_back(leftmost_index);
         convex_hull_points.push_back(points[leftmost_index]);
         // add rightmost point
@@ -266,7 +99,6 @@ convex_hull_points : vector<point>
         convex_hull_points.push_back(points[rightmost_index]);
     }
     else {
-        leftmost_index = find_leftmost_point(leftmost_val, points); // find leftmost point
         convex_hull.push_back(leftmost_index);
         bool not_complete_hull {true}; // this will change to False once the convex hull reaches its starting point
         
@@ -368,11 +200,13 @@ convex_hull_points : vector<point>
     return convex_hull_points;
 };
 
-std::vector<double> jarvis_march(std::vector<double> x, std::vector<double>& y)
+//[[Rcpp::export]]
+std::vector<double> jarvis_march(std::vector<double> x, std::vector<double>& y, bool drop_non_finite = false)
 /*
 Implement an alternative Jarvis march algorithm (for R package build). 
 
 This function takes the inputted x and y vectors, initialises a vector of points and finds its convex hull. 
+The hull is put into canonical form (see canonical_hull.h), so its ordering does not depend on the random candidates. 
 x coords of convex hull are returned. 
 
 Parameters
@@ -381,6 +215,9 @@ x : std::vector<double>
     x coords
 y : std::vector<double>
     y coords
+drop_non_finite : bool
+    if true, points with a NaN or infinite coordinate are dropped with a warning giving their number; ...
+    ... otherwise they are an error
 
 Returns
 -------
@@ -389,19 +226,60 @@ hull_x : std::vector<double>
 */
     
 {
-    // read points
-    // std::list<std::vector<double> > xy_pairs {readcsv(filename)};
+    if (x.size() != y.size())
+    {
+        stop("x and y must have the same length");
+    }
+
+    // validate and find the leftmost point in one pass
+    int n {(int) x.size()};
+    coordinate_scan scan {scan_coordinates(x.data(), y.data(), n)};
+    if (scan.non_finite > 0)
+    {
+        if (drop_non_finite == false)
+        {
+            stop("x and y contain %d points with non-finite coordinates; set drop_non_finite = TRUE to drop them", scan.non_finite);
+        }
+        warning("dropped %d points with non-finite coordinates", scan.non_finite);
+    }
+
+    /* read points, keeping only the first of any repeated point: find_convex_hull cannot tell ...
+    ... coincident points apart and would skip hull vertices next to them */
+    std::vector<int> rows {};
+    rows.reserve(n - scan.non_finite);
+    for(int i = 0; i < n; i++)
+    {
+        if (scan.non_finite == 0 || is_finite_point(x[i], y[i]))
+        {
+            rows.push_back(i);
+        }
+    }
+    sort_subset(x.data(), y.data(), rows);
+    std::vector<char> keep (n, 0);
+    for (int i : unique_points(x.data(), y.data(), rows))
+    {
+        keep[i] = 1;
+    }
     std::vector<point> points {};
-    for(int i = 0; i < x.size(); i++)
+    int leftmost_index {-1};
+    for(int i = 0; i < n; i++)
     {
-        point new_point(x[i],y[i]);
-        points.push_back(new_point);
+        if (keep[i] == 1)
+        {
+            // the leftmost row is the first of its repeats, so it is always kept
+            if (i == scan.leftmost)
+            {
+                leftmost_index = (int) points.size();
+            }
+            point new_point(x[i],y[i]);
+            points.push_back(new_point);
+        }
     }
 
     // find hull
     srand(10);
     std::vector<point> hull {};
-    hull = find_convex_hull(points);
+    hull = canonicalise_hull(find_convex_hull(points, leftmost_index));
     
     // output
     std::vector<double> hull_x {};
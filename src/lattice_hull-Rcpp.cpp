@@ -0,0 +1,246 @@
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+#include "canonical_hull.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// 128-bit integers hold cross products of 32-bit coordinate differences exactly
+typedef __int128 wide_int;
+
+struct lattice_point
+/*
+A structure to represent a single point with integer coordinates
+
+Attributes
+----------
+x : int64_t
+    x-coordinate
+y : int64_t
+    y-coordinate
+index : int
+    position of the point in the input
+
+Methods
+-------
+None
+*/
+{
+    int64_t x;
+    int64_t y;
+    int index;
+};
+
+wide_int lattice_cross(const lattice_point& o, const lattice_point& a, const lattice_point& b)
+/*
+Exact cross product of (a - o) and (b - o). Positive when o -> a -> b turns left (counterclockwise).
+
+Parameters
+----------
+o, a, b : lattice_point
+    the three points
+
+Returns
+-------
+cross : wide_int
+    the cross product, computed without rounding
+*/
+
+{
+    return (wide_int) (a.x - o.x) * (b.y - o.y) - (wide_int) (a.y - o.y) * (b.x - o.x);
+}
+
+int orientation(const lattice_point& p1, const lattice_point& p2, const lattice_point& p3)
+/*
+Exact orientation of a traversal from p1 to p3 via p2, as used by canonicalise_hull
+
+Parameters
+----------
+p1, p2, p3 : lattice_point
+    the three points
+
+Returns
+-------
+orientation : int
+    +1 for a left (counterclockwise) turn, -1 for a right turn and 0 if the points are collinear
+*/
+
+{
+    wide_int cross {lattice_cross(p1, p2, p3)};
+    return cross > 0 ? 1 : (cross < 0 ? -1 : 0);
+}
+
+int64_t lattice_gcd(int64_t a, int64_t b)
+/*
+Greatest common divisor of |a| and |b|
+
+Parameters
+----------
+a, b : int64_t
+
+Returns
+-------
+gcd : int64_t
+*/
+
+{
+    a = a < 0 ? -a : a;
+    b = b < 0 ? -b : b;
+    while (b != 0)
+    {
+        int64_t r {a % b};
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+std::vector<lattice_point> find_lattice_hull(std::vector<lattice_point> points)
+/*
+Finds the convex hull of a set of lattice points with Andrew's monotone chain, using exact integer orientation tests.
+Duplicate points and points in the interior of hull edges are dropped.
+The hull is counterclockwise and starts from the lowest of the leftmost points.
+
+Parameters
+----------
+points : vector<lattice_point>
+    points being analysed
+
+Returns
+-------
+hull : vector<lattice_point>
+    vertices of the convex hull
+*/
+
+{
+    std::sort(points.begin(), points.end(), [](const lattice_point& a, const lattice_point& b)
+    {
+        if (a.x != b.x) return a.x < b.x;
+        if (a.y != b.y) return a.y < b.y;
+        return a.index < b.index;
+    });
+    points.erase(std::unique(points.begin(), points.end(), [](const lattice_point& a, const lattice_point& b)
+    {
+        return a.x == b.x && a.y == b.y;
+    }), points.end());
+
+    int n {(int) points.size()};
+    if (n < 3)
+    {
+        return points;
+    }
+
+    // lower chain left to right, then upper chain right to left
+    std::vector<lattice_point> hull (2 * n);
+    int k {0};
+    for (int i = 0; i < n; i++)
+    {
+        while (k >= 2 && lattice_cross(hull[k - 2], hull[k - 1], points[i]) <= 0)
+        {
+            k--;
+        }
+        hull[k++] = points[i];
+    }
+    for (int i = n - 2, lower_size = k + 1; i >= 0; i--)
+    {
+        while (k >= lower_size && lattice_cross(hull[k - 2], hull[k - 1], points[i]) <= 0)
+        {
+            k--;
+        }
+        hull[k++] = points[i];
+    }
+    hull.resize(k - 1);
+    return hull;
+}
+
+// [[Rcpp::export]]
+List lattice_hull(IntegerVector x, IntegerVector y)
+/*
+Find the convex hull of integer lattice points, with its exact area and lattice point counts (for R package build).
+
+Twice the area is accumulated exactly in 128-bit integers; the number of lattice points on the boundary ...
+... is the sum of gcd(|dx|, |dy|) over the hull edges, and Pick's theorem A = I + B/2 - 1 gives the interior count.
+
+Parameters
+----------
+x : IntegerVector
+    x coords
+y : IntegerVector
+    y coords
+
+Returns
+-------
+hull : List
+    hull : IntegerVector
+        positions of the hull vertices in x and y (1-based), in canonical order (see canonical_hull.h)
+    area : double
+        area of the hull
+    boundary : double
+        number of lattice points on the boundary of the hull
+    interior : double
+        number of lattice points strictly inside the hull
+*/
+
+{
+    if (x.size() != y.size())
+    {
+        stop("x and y must have the same length");
+    }
+
+    // read points
+    std::vector<lattice_point> points {};
+    for (int i = 0; i < x.size(); i++)
+    {
+        if (x[i] == NA_INTEGER || y[i] == NA_INTEGER)
+        {
+            stop("coordinates must not be NA");
+        }
+        points.push_back(lattice_point {x[i], y[i], i});
+    }
+
+    // find hull
+    std::vector<lattice_point> hull {canonicalise_hull(find_lattice_hull(points))};
+    int h {(int) hull.size()};
+
+    // exact area and boundary count
+    wide_int twice_area {0};
+    int64_t boundary {0};
+    if (h == 1)
+    {
+        boundary = 1;
+    }
+    else if (h == 2)
+    {
+        boundary = lattice_gcd(hull[1].x - hull[0].x, hull[1].y - hull[0].y) + 1;
+    }
+    else if (h > 2)
+    {
+        for (int i = 0; i < h; i++)
+        {
+            const lattice_point& a {hull[i]};
+            const lattice_point& b {hull[(i + 1) % h]};
+            twice_area += (wide_int) a.x * b.y - (wide_int) b.x * a.y;
+            boundary += lattice_gcd(b.x - a.x, b.y - a.y);
+        }
+    }
+
+    // Pick's theorem, only meaningful for hulls with non-zero area
+    wide_int interior {0};
+    if (h > 2)
+    {
+        interior = (twice_area - boundary + 2) / 2;
+    }
+
+    // output
+    IntegerVector hull_index(h);
+    for (int i = 0; i < h; i++)
+    {
+        hull_index[i] = hull[i].index + 1;
+    }
+    return List::create(Named("hull") = hull_index,
+                        Named("area") = (double) twice_area / 2,
+                        Named("boundary") = (double) boundary,
+                        Named("interior") = (double) interior);
+}
@@ -0,0 +1,174 @@
+#include <vector>
+
+#include "line_envelope.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+XPtr<line_envelope> line_envelope_create()
+/*
+Create an empty lower envelope of lines for the convex hull trick (for R package build).
+The envelope lives in native memory and is kept between calls.
+
+Parameters
+----------
+None
+
+Returns
+-------
+envelope : XPtr<line_envelope>
+    external pointer to the envelope
+*/
+
+{
+    return XPtr<line_envelope>(new line_envelope(), true);
+}
+
+// [[Rcpp::export]]
+void line_envelope_add(XPtr<line_envelope> envelope, NumericVector slope, NumericVector intercept)
+/*
+Add a batch of lines to an envelope from line_envelope_create (for R package build).
+Slopes must be monotone: each line's slope must be at least the largest or at most the smallest so far.
+
+Parameters
+----------
+envelope : XPtr<line_envelope>
+    the envelope
+slope, intercept : NumericVector
+    the lines y = slope x + intercept, in order of insertion
+
+Returns
+-------
+None
+*/
+
+{
+    if (slope.size() != intercept.size())
+    {
+        stop("slope and intercept must have the same length");
+    }
+    for (int i = 0; i < slope.size(); i++)
+    {
+        envelope->add(slope[i], intercept[i]);
+    }
+}
+
+// [[Rcpp::export]]
+NumericVector line_envelope_query(XPtr<line_envelope> envelope, NumericVector x)
+/*
+Evaluate the lower envelope at a batch of points, in parallel (for R package build).
+
+Parameters
+----------
+envelope : XPtr<line_envelope>
+    the envelope
+x : NumericVector
+    where to evaluate it
+
+Returns
+-------
+value : NumericVector
+    least value of the lines at each x, Inf if no lines have been added
+*/
+
+{
+    int n {(int) x.size()};
+    const double* px {x.begin()};
+    const line_envelope& lines {*envelope};
+    NumericVector value(n);
+    double* value_out {value.begin()};
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < n; i++)
+    {
+        value_out[i] = lines.query(px[i]);
+    }
+    return value;
+}
+
+// [[Rcpp::export]]
+XPtr<li_chao_tree> li_chao_create(double lower, double upper)
+/*
+Create an empty Li Chao tree, a lower envelope of lines inserted in any order (for R package build).
+
+Parameters
+----------
+lower, upper : double
+    interval of x the tree will be queried on
+
+Returns
+-------
+tree : XPtr<li_chao_tree>
+    external pointer to the tree
+*/
+
+{
+    return XPtr<li_chao_tree>(new li_chao_tree(lower, upper), true);
+}
+
+// [[Rcpp::export]]
+void li_chao_add(XPtr<li_chao_tree> tree, NumericVector slope, NumericVector intercept)
+/*
+Add a batch of lines, in any order, to a tree from li_chao_create (for R package build).
+
+Parameters
+----------
+tree : XPtr<li_chao_tree>
+    the tree
+slope, intercept : NumericVector
+    the lines y = slope x + intercept
+
+Returns
+-------
+None
+*/
+
+{
+    if (slope.size() != intercept.size())
+    {
+        stop("slope and intercept must have the same length");
+    }
+    for (int i = 0; i < slope.size(); i++)
+    {
+        tree->add(slope[i], intercept[i]);
+    }
+}
+
+// [[Rcpp::export]]
+NumericVector li_chao_query(XPtr<li_chao_tree> tree, NumericVector x)
+/*
+Evaluate the lower envelope held in a Li Chao tree at a batch of points, in parallel (for R package build).
+
+Parameters
+----------
+tree : XPtr<li_chao_tree>
+    the tree
+x : NumericVector
+    where to evaluate it, within the interval given to li_chao_create
+
+Returns
+-------
+value : NumericVector
+    least value of the lines at each x, Inf if no lines have been added
+*/
+
+{
+    int n {(int) x.size()};
+    const double* px {x.begin()};
+    const li_chao_tree& lines {*tree};
+    for (int i = 0; i < n; i++)
+    {
+        if (!(px[i] >= lines.lower && px[i] <= lines.upper))
+        {
+            stop("x must lie within the interval of the tree");
+        }
+    }
+    NumericVector value(n);
+    double* value_out {value.begin()};
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < n; i++)
+    {
+        value_out[i] = lines.query(px[i]);
+    }
+    return value;
+}
@@ -0,0 +1,297 @@
+#ifndef LINE_ENVELOPE_H
+#define LINE_ENVELOPE_H
+
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "geometry.h"
+
+struct line_envelope
+/*
+A structure to maintain the lower envelope of lines y = slope x + intercept (the convex hull trick).
+A line lies on the lower envelope exactly when the point (slope, intercept) lies on the lower convex hull ...
+... of all such points, so lines are kept as a lower hull in increasing order of slope and pruned with the ...
+... same orientation predicate as triplet_of_points. Lines must arrive in monotone order of slope, at either end.
+
+Attributes
+----------
+lines : deque<point>
+    lines on the envelope as points (slope, intercept), in increasing order of slope
+
+Methods
+-------
+add:
+    insert a line, in amortised O(1)
+query:
+    least value of the lines at a given x, in O(log n)
+*/
+{
+    std::deque<point> lines {};
+
+    void add(double slope, double intercept)
+    /*
+    Insert a line whose slope is at least the largest or at most the smallest slope so far
+
+    Parameters
+    ----------
+    slope, intercept : double
+        the line
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        point line(slope, intercept);
+        if (lines.empty())
+        {
+            lines.push_back(line);
+        }
+        else if (slope >= lines.back().x)
+        {
+            if (slope == lines.back().x)
+            {
+                if (intercept >= lines.back().y)
+                {
+                    return;
+                }
+                lines.pop_back();
+            }
+            while (lines.size() >= 2 && orientation(lines[lines.size() - 2], lines.back(), line) <= 0)
+            {
+                lines.pop_back();
+            }
+            lines.push_back(line);
+        }
+        else if (slope <= lines.front().x)
+        {
+            if (slope == lines.front().x)
+            {
+                if (intercept >= lines.front().y)
+                {
+                    return;
+                }
+                lines.pop_front();
+            }
+            while (lines.size() >= 2 && orientation(line, lines[0], lines[1]) <= 0)
+            {
+                lines.pop_front();
+            }
+            lines.push_front(line);
+        }
+        else
+        {
+            throw std::invalid_argument("slopes must be added in monotone order; use li_chao_tree for arbitrary order");
+        }
+    }
+
+    double query(double x) const
+    /*
+    Least value of the lines at x. The values along the envelope fall and then rise, so the lowest ...
+    ... is found by a binary search on the differences between neighbours.
+
+    Parameters
+    ----------
+    x : double
+        where to evaluate the envelope
+
+    Returns
+    -------
+    value : double
+        infinite if no lines have been added
+    */
+
+    {
+        if (lines.empty())
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+        int low {0};
+        int high {(int) lines.size() - 1};
+        while (low < high)
+        {
+            int middle {(low + high) / 2};
+            if (lines[middle].x * x + lines[middle].y <= lines[middle + 1].x * x + lines[middle + 1].y)
+            {
+                high = middle;
+            }
+            else
+            {
+                low = middle + 1;
+            }
+        }
+        return lines[low].x * x + lines[low].y;
+    }
+};
+
+struct li_chao_tree
+/*
+A structure to maintain the lower envelope of lines inserted in any order, over an interval of x (Li Chao tree).
+Each node keeps the line which is lowest at the middle of its interval; the other line can only be lower ...
+... on one side, so it is passed down to that child. Intervals are halved at most max_depth times.
+
+Attributes
+----------
+lower, upper : double
+    interval of x covered
+slopes, intercepts : vector<double>
+    line kept at each node
+left, right : vector<int>
+    children of each node, -1 if none
+used : vector<char>
+    1 for nodes holding a line
+
+Methods
+-------
+add:
+    insert a line, in O(log)
+query:
+    least value of the lines at a given x, in O(log)
+*/
+{
+    static const int max_depth {64};
+    double lower;
+    double upper;
+    std::vector<double> slopes {0};
+    std::vector<double> intercepts {0};
+    std::vector<int> left {-1};
+    std::vector<int> right {-1};
+    std::vector<char> used {0};
+
+    li_chao_tree(double _lower, double _upper)
+    /*
+    Initialise instance of the li_chao_tree structure
+
+    Parameters
+    ----------
+    _lower, _upper : double
+        interval of x to be queried
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        if (!(_lower < _upper))
+        {
+            throw std::invalid_argument("lower must be less than upper");
+        }
+        lower = _lower;
+        upper = _upper;
+    }
+
+    int child(int node, bool to_left)
+    {
+        int next {to_left ? left[node] : right[node]};
+        if (next >= 0)
+        {
+            return next;
+        }
+        next = (int) used.size();
+        slopes.push_back(0);
+        intercepts.push_back(0);
+        left.push_back(-1);
+        right.push_back(-1);
+        used.push_back(0);
+        (to_left ? left[node] : right[node]) = next;
+        return next;
+    }
+
+    void add(double slope, double intercept)
+    /*
+    Insert a line
+
+    Parameters
+    ----------
+    slope, intercept : double
+        the line
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        int node {0};
+        double low {lower};
+        double high {upper};
+        for (int depth = 0; ; depth++)
+        {
+            if (used[node] == 0)
+            {
+                slopes[node] = slope;
+                intercepts[node] = intercept;
+                used[node] = 1;
+                return;
+            }
+            double middle {low + (high - low) / 2};
+            bool lower_at_low {slope * low + intercept < slopes[node] * low + intercepts[node]};
+            bool lower_at_middle {slope * middle + intercept < slopes[node] * middle + intercepts[node]};
+            if (lower_at_middle)
+            {
+                std::swap(slope, slopes[node]);
+                std::swap(intercept, intercepts[node]);
+            }
+            if (depth >= max_depth || !(low < middle) || !(middle < high))
+            {
+                return;
+            }
+            // the line kept at the node is lower at the middle, so the other can only win on one side
+            if (lower_at_low != lower_at_middle)
+            {
+                node = child(node, true);
+                high = middle;
+            }
+            else
+            {
+                node = child(node, false);
+                low = middle;
+            }
+        }
+    }
+
+    double query(double x) const
+    /*
+    Least value of the lines at x
+
+    Parameters
+    ----------
+    x : double
+        where to evaluate the envelope, between lower and upper
+
+    Returns
+    -------
+    value : double
+        infinite if no lines have been added
+    */
+
+    {
+        double value {std::numeric_limits<double>::infinity()};
+        int node {0};
+        double low {lower};
+        double high {upper};
+        while (node >= 0 && used[node] == 1)
+        {
+            value = std::min(value, slopes[node] * x + intercepts[node]);
+            double middle {low + (high - low) / 2};
+            if (x < middle)
+            {
+                node = left[node];
+                high = middle;
+            }
+            else
+            {
+                node = right[node];
+                low = middle;
+            }
+        }
+        return value;
+    }
+};
+
+#endif
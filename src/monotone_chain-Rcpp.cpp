@@ -0,0 +1,53 @@
+#include <vector>
+#include <string>
+
+#include "monotone_chain.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+IntegerVector convex_hull(NumericVector x, NumericVector y, std::string chain = "full")
+/*
+Find the convex hull of a point set with the monotone chain, or only its upper or lower chain (for R package build).
+Points are read in place. A single chain skips the other half of the work, e.g. for efficient frontiers ...
+... or envelopes of curves.
+
+Parameters
+----------
+x : NumericVector
+    x coords
+y : NumericVector
+    y coords
+chain : std::string
+    "full" for the whole hull, "lower" or "upper" for one chain
+
+Returns
+-------
+hull : IntegerVector
+    positions of the hull vertices in x, y (1-based). The full hull is in canonical form ...
+    ... (see canonical_hull.h), so it lists the same points in the same order as find_convex_hull. ...
+    ... A chain runs in increasing order of x and includes both of its ends.
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n)
+    {
+        stop("x and y must have the same length");
+    }
+    if (chain != "full" && chain != "lower" && chain != "upper")
+    {
+        stop("chain must be \"full\", \"lower\" or \"upper\"");
+    }
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    std::vector<int> order {sort_points(px, py, n)};
+    std::vector<int> hull {chain == "full" ? monotone_chain(px, py, order) : monotone_half_chain(px, py, order, chain == "upper")};
+    for (int& i : hull)
+    {
+        i++;
+    }
+    return IntegerVector(hull.begin(), hull.end());
+}
@@ -0,0 +1,312 @@
+#ifndef MONOTONE_CHAIN_H
+#define MONOTONE_CHAIN_H
+
+#include <vector>
+#include <algorithm>
+
+#include "geometry.h"
+
+inline std::vector<int> sort_points(const double* x, const double* y, int n)
+/*
+Sort stage of the monotone chain: order points by x-coordinate, then y-coordinate, then position.
+The order can be kept and reused to rebuild hulls of subsets without sorting again. ...
+... Points which are already in order are detected in O(n) and not sorted.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+n : int
+    number of points
+
+Returns
+-------
+order : vector<int>
+    indices of the points in sorted order
+*/
+
+{
+    std::vector<int> order (n);
+    for (int i = 0; i < n; i++)
+    {
+        order[i] = i;
+    }
+    auto less = [x, y](int a, int b)
+    {
+        if (x[a] != x[b]) return x[a] < x[b];
+        if (y[a] != y[b]) return y[a] < y[b];
+        return a < b;
+    };
+    if (!std::is_sorted(order.begin(), order.end(), less))
+    {
+        std::sort(order.begin(), order.end(), less);
+    }
+    return order;
+}
+
+inline void sort_subset(const double* x, const double* y, std::vector<int>& ids)
+/*
+Sort a subset of points in the order used by sort_points: by x-coordinate, then y-coordinate, then index
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+ids : vector<int>&
+    indices of the subset, sorted in place
+
+Returns
+-------
+None
+*/
+
+{
+    std::sort(ids.begin(), ids.end(), [x, y](int a, int b)
+    {
+        if (x[a] != x[b]) return x[a] < x[b];
+        if (y[a] != y[b]) return y[a] < y[b];
+        return a < b;
+    });
+}
+
+inline std::vector<int> unique_points(const double* x, const double* y, const std::vector<int>& order,
+                                      const std::vector<char>& alive = std::vector<char>())
+/*
+Dedup stage of the monotone chain: skip repeated points, keeping the first in the sorted order.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+order : vector<int>
+    indices of the points, from sort_points
+alive : vector<char>
+    if not empty, only points with alive[i] == 1 are used
+
+Returns
+-------
+unique : vector<int>
+    indices of the distinct points, in sorted order
+*/
+
+{
+    std::vector<int> unique {};
+    unique.reserve(order.size());
+    for (int i : order)
+    {
+        if (!alive.empty() && alive[i] == 0)
+        {
+            continue;
+        }
+        if (!unique.empty() && x[unique.back()] == x[i] && y[unique.back()] == y[i])
+        {
+            continue;
+        }
+        unique.push_back(i);
+    }
+    return unique;
+}
+
+inline std::vector<int> monotone_chain(const double* x, const double* y, const std::vector<int>& order,
+                                       const std::vector<char>& alive = std::vector<char>())
+/*
+Finds the convex hull of presorted points with Andrew's monotone chain, in O(n).
+The lower chain is built left to right and the upper chain right to left, ...
+... turning with the same orientation predicate as triplet_of_points.
+Repeated points are skipped (dedup stage), keeping the first in the sorted order.
+The hull is in canonical form (see canonical_hull.h): counterclockwise from the lowest leftmost point, without collinear points.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+order : vector<int>
+    indices of the points, from sort_points
+alive : vector<char>
+    if not empty, only points with alive[i] == 1 are used
+
+Returns
+-------
+hull : vector<int>
+    indices of the points on the hull
+*/
+
+{
+    std::vector<int> unique {unique_points(x, y, order, alive)};
+    int n {(int) unique.size()};
+    if (n < 3)
+    {
+        return unique;
+    }
+
+    std::vector<int> hull (2 * n);
+    int k {0};
+    for (int i = 0; i < n; i++)
+    {
+        point p(x[unique[i]], y[unique[i]]);
+        while (k >= 2 && orientation(point(x[hull[k - 2]], y[hull[k - 2]]), point(x[hull[k - 1]], y[hull[k - 1]]), p) <= 0)
+        {
+            k--;
+        }
+        hull[k++] = unique[i];
+    }
+    for (int i = n - 2, lower_size = k + 1; i >= 0; i--)
+    {
+        point p(x[unique[i]], y[unique[i]]);
+        while (k >= lower_size && orientation(point(x[hull[k - 2]], y[hull[k - 2]]), point(x[hull[k - 1]], y[hull[k - 1]]), p) <= 0)
+        {
+            k--;
+        }
+        hull[k++] = unique[i];
+    }
+    hull.resize(k - 1);
+    return hull;
+}
+
+inline std::vector<int> monotone_half_chain(const double* x, const double* y, const std::vector<int>& order, bool upper)
+/*
+Finds only the lower or the upper chain of the convex hull of presorted points, in one pass instead of two.
+The lower chain runs from the first vertex of the canonical hull (lowest leftmost point) to the highest ...
+... rightmost point, and the upper chain is the rest of the hull; together they make up monotone_chain.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+order : vector<int>
+    indices of the points, from sort_points
+upper : bool
+    find the upper chain rather than the lower
+
+Returns
+-------
+chain : vector<int>
+    indices of the points on the chain, including both ends, in increasing order of x
+*/
+
+{
+    std::vector<int> unique {unique_points(x, y, order)};
+    int n {(int) unique.size()};
+    if (n < 3)
+    {
+        return unique;
+    }
+
+    // the upper chain turns the same way as the lower when built right to left
+    std::vector<int> chain (n);
+    int k {0};
+    for (int r = 0; r < n; r++)
+    {
+        int i {upper ? unique[n - 1 - r] : unique[r]};
+        point p(x[i], y[i]);
+        while (k >= 2 && orientation(point(x[chain[k - 2]], y[chain[k - 2]]), point(x[chain[k - 1]], y[chain[k - 1]]), p) <= 0)
+        {
+            k--;
+        }
+        chain[k++] = i;
+    }
+    chain.resize(k);
+    if (upper)
+    {
+        std::reverse(chain.begin(), chain.end());
+    }
+    return chain;
+}
+
+inline std::vector<int> hull_boundary(const double* x, const double* y, const std::vector<int>& order)
+/*
+Finds every point on the boundary of the convex hull of presorted points, in O(n): the hull vertices, ...
+... points in the interior of hull edges and repeats of any of these. Both monotone chains are built ...
+... keeping collinear points, and between them they pass through every boundary point.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+order : vector<int>
+    indices of the points, from sort_points or a subsequence of it
+
+Returns
+-------
+boundary : vector<int>
+    indices of the points on the boundary, in sorted order
+*/
+
+{
+    // dedup stage, remembering the first of each run of repeated points
+    std::vector<int> unique {};
+    std::vector<int> first (order.size());
+    for (size_t r = 0; r < order.size(); r++)
+    {
+        int i {order[r]};
+        if (unique.empty() || x[unique.back()] != x[i] || y[unique.back()] != y[i])
+        {
+            unique.push_back(i);
+        }
+        first[r] = (int) unique.size() - 1;
+    }
+
+    int n {(int) unique.size()};
+    std::vector<char> on_boundary (n, n < 3 ? 1 : 0);
+    if (n >= 3)
+    {
+        std::vector<int> chain (n);
+        for (int pass = 0; pass < 2; pass++)
+        {
+            int k {0};
+            for (int r = 0; r < n; r++)
+            {
+                int u {pass == 0 ? r : n - 1 - r};
+                point p(x[unique[u]], y[unique[u]]);
+                while (k >= 2 && orientation(point(x[unique[chain[k - 2]]], y[unique[chain[k - 2]]]),
+                                             point(x[unique[chain[k - 1]]], y[unique[chain[k - 1]]]), p) < 0)
+                {
+                    k--;
+                }
+                chain[k++] = u;
+            }
+            for (int r = 0; r < k; r++)
+            {
+                on_boundary[chain[r]] = 1;
+            }
+        }
+    }
+
+    std::vector<int> boundary {};
+    for (size_t r = 0; r < order.size(); r++)
+    {
+        if (on_boundary[first[r]] == 1)
+        {
+            boundary.push_back(order[r]);
+        }
+    }
+    return boundary;
+}
+
+inline double hull_area(const double* x, const double* y, const std::vector<int>& hull)
+/*
+Area enclosed by a hull given by point indices (shoelace formula)
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+hull : vector<int>
+    indices of the hull vertices, counterclockwise
+
+Returns
+-------
+area : double
+*/
+
+{
+    int h {(int) hull.size()};
+    double twice_area {0};
+    for (int i = 0, j = h - 1; i < h; j = i++)
+    {
+        twice_area += x[hull[j]] * y[hull[i]] - x[hull[i]] * y[hull[j]];
+    }
+    return h < 3 ? 0.0 : twice_area / 2;
+}
+
+#endif
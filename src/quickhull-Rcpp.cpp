@@ -0,0 +1,89 @@
+#include <vector>
+#include <algorithm>
+
+#include "quickhull.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+List quickhull(NumericMatrix points)
+/*
+Find the convex hull of points in d >= 2 dimensions (for R package build).
+
+Parameters
+----------
+points : NumericMatrix
+    n x d matrix, one point per row
+
+Returns
+-------
+hull : List
+    vertices : IntegerVector
+        rows of points which are vertices of the hull (1-based)
+    facets : IntegerMatrix
+        one facet per row, given by the d rows of points spanning it (1-based).
+        Vertices within a facet are increasing and facets are in lexicographic order.
+    neighbours : IntegerMatrix
+        neighbours[f, i] is the facet sharing the ridge opposite facets[f, i] (1-based)
+    normals : NumericMatrix
+        unit outward normal of each facet
+    offsets : NumericVector
+        offset of each facet, such that normal . x = offset on the facet
+*/
+
+{
+    int n {points.nrow()};
+    int d {points.ncol()};
+
+    // copy into row-major order so each point is contiguous
+    std::vector<double> coords (n * d);
+    for (int j = 0; j < d; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            coords[i * d + j] = points(i, j);
+        }
+    }
+
+    // find hull
+    quickhull_engine engine(coords.data(), n, d);
+    engine.build();
+
+    // output
+    std::vector<int> facets {engine.hull_facets()};
+    std::vector<int> row_of_facet (engine.pool.alive.size(), -1);
+    for (int r = 0; r < (int) facets.size(); r++)
+    {
+        row_of_facet[facets[r]] = r;
+    }
+
+    int n_facets {(int) facets.size()};
+    IntegerMatrix facet_vertices(n_facets, d);
+    IntegerMatrix facet_neighbours(n_facets, d);
+    NumericMatrix normals(n_facets, d);
+    NumericVector offsets(n_facets);
+    for (int r = 0; r < n_facets; r++)
+    {
+        int f {facets[r]};
+        for (int i = 0; i < d; i++)
+        {
+            facet_vertices(r, i) = engine.pool.vertices[f * d + i] + 1;
+            facet_neighbours(r, i) = row_of_facet[engine.pool.neighbours[f * d + i]] + 1;
+            normals(r, i) = engine.pool.normals[f * d + i];
+        }
+        offsets[r] = engine.pool.offsets[f];
+    }
+
+    std::vector<int> vertices {engine.hull_vertices()};
+    for (int& v : vertices)
+    {
+        v++;
+    }
+
+    return List::create(Named("vertices") = vertices,
+                        Named("facets") = facet_vertices,
+                        Named("neighbours") = facet_neighbours,
+                        Named("normals") = normals,
+                        Named("offsets") = offsets);
+}
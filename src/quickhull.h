@@ -0,0 +1,949 @@
+#ifndef QUICKHULL_H
+#define QUICKHULL_H
+
+#include <vector>
+#include <utility>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+struct simplex_of_points
+/*
+A structure to represent a group of d+1 points (p_0, ..., p_d) in d-dimensional space.
+This generalises triplet_of_points: the sign of the determinant tells us which side of the ...
+... hyperplane through p_0, ..., p_{d-1} the last point p_d lies on.
+quickhull_engine uses it to confirm that the initial simplex has volume; visibility in the main loop is ...
+... the plain distance of a point above a facet hyperplane, compared with a fixed tolerance.
+
+Attributes
+----------
+above :
+    True if p_d lies on the positive side of the hyperplane through the first d points.
+coplanar :
+    True if the d+1 points lie on a common hyperplane, up to round-off.
+determinent :
+    the determinent of the d x d matrix with rows (p_i - p_0), i = 1, ..., d
+error_bound :
+    bound on the round-off error in determinent.
+    Determinants smaller than this in magnitude are treated as zero.
+
+Methods
+-------
+find_orientation:
+    determines whether p_d lies above, below or on the hyperplane through the other points.
+*/
+{
+    bool above {};
+    bool coplanar {};
+    double determinent {};
+    double error_bound {};
+
+    simplex_of_points(const std::vector<const double*>& simplex, int dimension)
+    /*
+    Initialise instance of the simplex_of_points structure.
+    The determinent is found by Gaussian elimination with partial pivoting in extended precision.
+
+    Parameters
+    ----------
+    simplex : vector<const double*>
+        pointers to the coordinates of the d+1 points, each of length dimension
+    dimension : int
+        dimension d of the space
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        std::vector<long double> matrix (dimension * dimension);
+        long double hadamard {1.0L};
+        for (int i = 0; i < dimension; i++)
+        {
+            long double row_norm {0.0L};
+            for (int j = 0; j < dimension; j++)
+            {
+                matrix[i * dimension + j] = (long double) simplex[i + 1][j] - simplex[0][j];
+                row_norm += matrix[i * dimension + j] * matrix[i * dimension + j];
+            }
+            hadamard *= std::sqrt(row_norm);
+        }
+
+        long double det {1.0L};
+        for (int col = 0; col < dimension; col++)
+        {
+            // choose the largest pivot in this column
+            int pivot {col};
+            for (int row = col + 1; row < dimension; row++)
+            {
+                if (std::fabs(matrix[row * dimension + col]) > std::fabs(matrix[pivot * dimension + col]))
+                {
+                    pivot = row;
+                }
+            }
+            if (matrix[pivot * dimension + col] == 0)
+            {
+                det = 0;
+                break;
+            }
+            if (pivot != col)
+            {
+                for (int j = 0; j < dimension; j++)
+                {
+                    std::swap(matrix[pivot * dimension + j], matrix[col * dimension + j]);
+                }
+                det = -det;
+            }
+            det *= matrix[col * dimension + col];
+            for (int row = col + 1; row < dimension; row++)
+            {
+                long double factor {matrix[row * dimension + col] / matrix[col * dimension + col]};
+                for (int j = col; j < dimension; j++)
+                {
+                    matrix[row * dimension + j] -= factor * matrix[col * dimension + j];
+                }
+            }
+        }
+        determinent = (double) det;
+
+        // Hadamard's inequality bounds |det|, so a small multiple of it bounds the round-off
+        error_bound = (double) (hadamard * dimension * dimension * std::numeric_limits<double>::epsilon());
+    }
+
+    void find_orientation()
+    /*
+    Find the orientation of the simplex, i.e. whether the last point lies above the hyperplane through the others.
+    Also identify if the points are coplanar.
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        if (std::fabs(determinent) <= error_bound) // within round-off of a flat simplex
+        {
+            above = false;
+            coplanar = true;
+        }
+        else
+        {
+            above = determinent > 0;
+            coplanar = false;
+        }
+    }
+};
+
+struct facet_pool
+/*
+A memory pool holding the facets of a d-dimensional hull in flat arrays.
+Each facet occupies a fixed-size slot, so creating and deleting facets during the ...
+... construction never touches the heap once the pool has grown to its working size.
+Released slots are recycled through a free list; outside sets keep their capacity when recycled.
+
+Attributes
+----------
+dimension : int
+    dimension d of the space. Each facet has d vertices and d neighbours.
+vertices : vector<int>
+    vertices[f*d + i] is the i-th vertex (point index) of facet f
+neighbours : vector<int>
+    neighbours[f*d + i] is the facet sharing the ridge opposite vertices[f*d + i]
+normals : vector<double>
+    unit outward normal of each facet, d entries per facet
+offsets : vector<double>
+    offset of each facet, such that normal . x = offset on the facet
+outside : vector<vector<int>>
+    indices of points lying above each facet
+furthest : vector<int>
+    index of the point in the outside set furthest from each facet
+alive : vector<char>
+    1 if the slot holds a facet currently on the hull
+free_slots : vector<int>
+    released slots available for reuse
+
+Methods
+-------
+allocate:
+    returns a free facet slot
+release:
+    returns a facet slot to the pool
+*/
+{
+    int dimension {};
+    std::vector<int> vertices {};
+    std::vector<int> neighbours {};
+    std::vector<double> normals {};
+    std::vector<double> offsets {};
+    std::vector<std::vector<int> > outside {};
+    std::vector<int> furthest {};
+    std::vector<char> alive {};
+    std::vector<int> free_slots {};
+
+    facet_pool(int _dimension)
+    /*
+    Initialise an empty pool
+
+    Parameters
+    ----------
+    _dimension : int
+        dimension d of the space
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        dimension = _dimension;
+    }
+
+    int allocate()
+    /*
+    Take a facet slot from the free list, or grow the pool by one slot if the free list is empty.
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    f : int
+        index of the allocated facet
+    */
+
+    {
+        int f {};
+        if (!free_slots.empty())
+        {
+            f = free_slots.back();
+            free_slots.pop_back();
+        }
+        else
+        {
+            f = (int) alive.size();
+            vertices.resize(vertices.size() + dimension);
+            neighbours.resize(neighbours.size() + dimension);
+            normals.resize(normals.size() + dimension);
+            offsets.push_back(0);
+            outside.emplace_back();
+            furthest.push_back(-1);
+            alive.push_back(0);
+        }
+        alive[f] = 1;
+        furthest[f] = -1;
+        outside[f].clear();
+        return f;
+    }
+
+    void release(int f)
+    /*
+    Return a facet slot to the pool
+
+    Parameters
+    ----------
+    f : int
+        index of the facet
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        alive[f] = 0;
+        outside[f].clear();
+        free_slots.push_back(f);
+    }
+};
+
+struct quickhull_engine
+/*
+A structure to find the convex hull of n points in d dimensions (d >= 2) using Quickhull.
+
+Starting from a d-simplex of extreme points, the engine repeatedly takes the furthest outside point ...
+... of some facet, deletes every facet visible from it and cones the horizon ridges to the new point.
+A point is "outside" a facet when it lies more than tolerance above the facet's hyperplane.
+
+Attributes
+----------
+dimension : int
+    dimension d of the space
+n_points : int
+    number of points
+coords : const double*
+    row-major coordinates, coords[p*d + j] is coordinate j of point p
+tolerance : double
+    distance below which a point is treated as lying on a facet
+interior : vector<double>
+    a point strictly inside the hull, used to orient facet normals outwards
+pool : facet_pool
+    storage for the facets
+plane_matrix, plane_normal, plane_column : vector
+    scratch space for find_hyperplane, sized once so new facets do not allocate
+
+Methods
+-------
+build:
+    computes the hull
+distance:
+    signed distance of a point above a facet
+canonicalise_facets:
+    puts the vertices of each facet into increasing order
+hull_facets:
+    indices of facets on the finished hull
+hull_vertices:
+    indices of points on the finished hull
+*/
+{
+    int dimension {};
+    int n_points {};
+    const double* coords {};
+    double tolerance {};
+    std::vector<double> interior {};
+    facet_pool pool;
+    std::vector<long double> plane_matrix {};
+    std::vector<long double> plane_normal {};
+    std::vector<int> plane_column {};
+
+    quickhull_engine(const double* _coords, int _n_points, int _dimension) : pool(_dimension)
+    /*
+    Initialise instance of the quickhull_engine structure
+
+    Parameters
+    ----------
+    _coords : const double*
+        row-major coordinates of the points
+    _n_points : int
+        number of points
+    _dimension : int
+        dimension of the space
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        coords = _coords;
+        n_points = _n_points;
+        dimension = _dimension;
+
+        double max_abs {0};
+        for (int k = 0; k < n_points * dimension; k++)
+        {
+            max_abs = std::max(max_abs, std::fabs(coords[k]));
+        }
+        tolerance = 10 * dimension * std::max(max_abs, 1.0) * std::numeric_limits<double>::epsilon();
+        plane_matrix.resize(std::max(dimension - 1, 0) * dimension);
+        plane_normal.resize(dimension);
+        plane_column.resize(dimension);
+    }
+
+    double distance(int f, int p) const
+    /*
+    Signed distance of point p above facet f
+
+    Parameters
+    ----------
+    f : int
+        index of the facet
+    p : int
+        index of the point
+
+    Returns
+    -------
+    distance : double
+        positive if p lies outside the facet
+    */
+
+    {
+        const double* normal {&pool.normals[f * dimension]};
+        const double* x {coords + p * dimension};
+        double dot {0};
+        for (int j = 0; j < dimension; j++)
+        {
+            dot += normal[j] * x[j];
+        }
+        return dot - pool.offsets[f];
+    }
+
+    void find_hyperplane(int f)
+    /*
+    Compute the unit outward normal and offset of facet f from its vertices.
+    The normal spans the null space of the edge vectors (v_i - v_0), found by Gaussian elimination ...
+    ... with full pivoting in extended precision.
+
+    Parameters
+    ----------
+    f : int
+        index of the facet
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        int d {dimension};
+        int rows {d - 1};
+        const int* vertex {&pool.vertices[f * d]};
+        const double* origin {coords + vertex[0] * d};
+
+        std::vector<long double>& matrix {plane_matrix};
+        for (int i = 0; i < rows; i++)
+        {
+            const double* x {coords + vertex[i + 1] * d};
+            for (int j = 0; j < d; j++)
+            {
+                matrix[i * d + j] = (long double) x[j] - origin[j];
+            }
+        }
+
+        // reduce to upper triangular form, permuting columns so the free column ends up last
+        std::vector<int>& column {plane_column};
+        for (int j = 0; j < d; j++)
+        {
+            column[j] = j;
+        }
+        for (int k = 0; k < rows; k++)
+        {
+            int pivot_row {k};
+            int pivot_col {k};
+            for (int i = k; i < rows; i++)
+            {
+                for (int j = k; j < d; j++)
+                {
+                    if (std::fabs(matrix[i * d + column[j]]) > std::fabs(matrix[pivot_row * d + column[pivot_col]]))
+                    {
+                        pivot_row = i;
+                        pivot_col = j;
+                    }
+                }
+            }
+            if (matrix[pivot_row * d + column[pivot_col]] == 0)
+            {
+                throw std::runtime_error("degenerate facet encountered in quickhull");
+            }
+            for (int j = 0; j < d; j++)
+            {
+                std::swap(matrix[pivot_row * d + j], matrix[k * d + j]);
+            }
+            std::swap(column[pivot_col], column[k]);
+            for (int i = k + 1; i < rows; i++)
+            {
+                long double factor {matrix[i * d + column[k]] / matrix[k * d + column[k]]};
+                for (int j = k; j < d; j++)
+                {
+                    matrix[i * d + column[j]] -= factor * matrix[k * d + column[j]];
+                }
+            }
+        }
+
+        // back substitution with the free variable set to one
+        std::vector<long double>& normal {plane_normal};
+        std::fill(normal.begin(), normal.end(), 0.0L);
+        normal[column[d - 1]] = 1.0L;
+        for (int k = rows - 1; k >= 0; k--)
+        {
+            long double sum {0.0L};
+            for (int j = k + 1; j < d; j++)
+            {
+                sum += matrix[k * d + column[j]] * normal[column[j]];
+            }
+            normal[column[k]] = -sum / matrix[k * d + column[k]];
+        }
+
+        long double norm {0.0L};
+        for (int j = 0; j < d; j++)
+        {
+            norm += normal[j] * normal[j];
+        }
+        norm = std::sqrt(norm);
+
+        // orient away from the interior point
+        long double offset {0.0L};
+        long double interior_side {0.0L};
+        for (int j = 0; j < d; j++)
+        {
+            normal[j] /= norm;
+            offset += normal[j] * origin[j];
+            interior_side += normal[j] * interior[j];
+        }
+        double sign {interior_side > offset ? -1.0 : 1.0};
+        for (int j = 0; j < d; j++)
+        {
+            pool.normals[f * d + j] = sign * (double) normal[j];
+        }
+        pool.offsets[f] = sign * (double) offset;
+    }
+
+    std::vector<int> initial_simplex()
+    /*
+    Choose d+1 affinely independent points to start from.
+    The first two are an extreme point and the point furthest from it. Each further point maximises ...
+    ... its distance from the affine hull of those chosen so far (Gram-Schmidt on the offsets).
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    simplex : vector<int>
+        indices of the d+1 points
+    */
+
+    {
+        int d {dimension};
+        std::vector<int> simplex {};
+
+        int first {0};
+        for (int p = 1; p < n_points; p++)
+        {
+            if (coords[p * d] < coords[first * d])
+            {
+                first = p;
+            }
+        }
+        simplex.push_back(first);
+
+        std::vector<std::vector<double> > basis {};
+        std::vector<double> residual (d);
+        for (int k = 1; k <= d; k++)
+        {
+            int best {-1};
+            double best_norm {0};
+            for (int p = 0; p < n_points; p++)
+            {
+                for (int j = 0; j < d; j++)
+                {
+                    residual[j] = coords[p * d + j] - coords[first * d + j];
+                }
+                for (const std::vector<double>& e : basis)
+                {
+                    double dot {0};
+                    for (int j = 0; j < d; j++)
+                    {
+                        dot += residual[j] * e[j];
+                    }
+                    for (int j = 0; j < d; j++)
+                    {
+                        residual[j] -= dot * e[j];
+                    }
+                }
+                double norm {0};
+                for (int j = 0; j < d; j++)
+                {
+                    norm += residual[j] * residual[j];
+                }
+                norm = std::sqrt(norm);
+                if (norm > best_norm)
+                {
+                    best_norm = norm;
+                    best = p;
+                }
+            }
+            if (best < 0 || best_norm <= tolerance)
+            {
+                throw std::runtime_error("points do not span the full dimension; the hull is degenerate");
+            }
+
+            // extend the orthonormal basis with the new direction
+            std::vector<double> e (d);
+            for (int j = 0; j < d; j++)
+            {
+                e[j] = coords[best * d + j] - coords[first * d + j];
+            }
+            for (const std::vector<double>& b : basis)
+            {
+                double dot {0};
+                for (int j = 0; j < d; j++)
+                {
+                    dot += e[j] * b[j];
+                }
+                for (int j = 0; j < d; j++)
+                {
+                    e[j] -= dot * b[j];
+                }
+            }
+            double norm {0};
+            for (int j = 0; j < d; j++)
+            {
+                norm += e[j] * e[j];
+            }
+            norm = std::sqrt(norm);
+            for (int j = 0; j < d; j++)
+            {
+                e[j] /= norm;
+            }
+            basis.push_back(e);
+            simplex.push_back(best);
+        }
+
+        // confirm the simplex has volume using the robust orientation test
+        std::vector<const double*> corners {};
+        for (int p : simplex)
+        {
+            corners.push_back(coords + p * d);
+        }
+        simplex_of_points orientation(corners, d);
+        orientation.find_orientation();
+        if (orientation.coplanar == true)
+        {
+            throw std::runtime_error("points do not span the full dimension; the hull is degenerate");
+        }
+        return simplex;
+    }
+
+    void assign_outside(int p, const std::vector<int>& candidates)
+    /*
+    Add point p to the outside set of the first candidate facet it lies above, if any.
+
+    Parameters
+    ----------
+    p : int
+        index of the point
+    candidates : vector<int>
+        facets to test
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        for (int f : candidates)
+        {
+            double dist {distance(f, p)};
+            if (dist > tolerance)
+            {
+                pool.outside[f].push_back(p);
+                if (pool.furthest[f] < 0 || dist > distance(f, pool.furthest[f]))
+                {
+                    pool.furthest[f] = p;
+                }
+                return;
+            }
+        }
+    }
+
+    void build()
+    /*
+    Compute the convex hull
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        int d {dimension};
+        if (d < 2)
+        {
+            throw std::invalid_argument("quickhull needs points in at least two dimensions");
+        }
+        if (n_points < d + 1)
+        {
+            throw std::invalid_argument("quickhull needs at least d+1 points");
+        }
+
+        std::vector<int> simplex {initial_simplex()};
+        interior.assign(d, 0.0);
+        for (int p : simplex)
+        {
+            for (int j = 0; j < d; j++)
+            {
+                interior[j] += coords[p * d + j] / (d + 1);
+            }
+        }
+
+        // facet k of the simplex is opposite simplex vertex k
+        std::vector<int> initial (d + 1);
+        for (int k = 0; k <= d; k++)
+        {
+            initial[k] = pool.allocate();
+        }
+        for (int k = 0; k <= d; k++)
+        {
+            int slot {0};
+            for (int m = 0; m <= d; m++)
+            {
+                if (m != k)
+                {
+                    pool.vertices[initial[k] * d + slot] = simplex[m];
+                    pool.neighbours[initial[k] * d + slot] = initial[m];
+                    slot++;
+                }
+            }
+            find_hyperplane(initial[k]);
+        }
+
+        std::vector<char> in_simplex (n_points, 0);
+        for (int p : simplex)
+        {
+            in_simplex[p] = 1;
+        }
+        for (int p = 0; p < n_points; p++)
+        {
+            if (in_simplex[p] == 0)
+            {
+                assign_outside(p, initial);
+            }
+        }
+
+        std::vector<int> pending {initial};
+        std::vector<int> visit_stamp {};
+        std::vector<int> visible {};
+        std::vector<int> new_facets {};
+        std::vector<int> ridges {};
+        std::vector<int> ridge_order {};
+        int stamp {0};
+
+        // main loop
+        while (!pending.empty())
+        {
+            int f {pending.back()};
+            pending.pop_back();
+            if (pool.alive[f] == 0 || pool.outside[f].empty())
+            {
+                continue;
+            }
+            int apex {pool.furthest[f]};
+
+            // find every facet visible from the apex by walking across neighbours
+            stamp++;
+            visit_stamp.resize(pool.alive.size(), 0);
+            visible.clear();
+            visible.push_back(f);
+            visit_stamp[f] = stamp;
+            for (size_t v = 0; v < visible.size(); v++)
+            {
+                for (int i = 0; i < d; i++)
+                {
+                    int g {pool.neighbours[visible[v] * d + i]};
+                    if (visit_stamp[g] != stamp && distance(g, apex) > tolerance)
+                    {
+                        visit_stamp[g] = stamp;
+                        visible.push_back(g);
+                    }
+                }
+            }
+
+            // cone each horizon ridge to the apex
+            new_facets.clear();
+            for (int v : visible)
+            {
+                for (int i = 0; i < d; i++)
+                {
+                    int g {pool.neighbours[v * d + i]};
+                    if (visit_stamp[g] == stamp)
+                    {
+                        continue;
+                    }
+                    int nf {pool.allocate()};
+                    for (int j = 0; j < d; j++)
+                    {
+                        pool.vertices[nf * d + j] = (j == i) ? apex : pool.vertices[v * d + j];
+                        pool.neighbours[nf * d + j] = -1;
+                    }
+                    pool.neighbours[nf * d + i] = g;
+                    for (int j = 0; j < d; j++)
+                    {
+                        if (pool.neighbours[g * d + j] == v)
+                        {
+                            pool.neighbours[g * d + j] = nf;
+                        }
+                    }
+                    find_hyperplane(nf);
+                    new_facets.push_back(nf);
+                }
+            }
+            visit_stamp.resize(pool.alive.size(), 0);
+
+            /* new facets sharing a ridge through the apex are neighbours of each other. The open ridges ...
+            ... go into a flat buffer, each as its d - 1 sorted vertices followed by the facet and slot, ...
+            ... and sorting them brings the two copies of each ridge together. */
+            int stride {d + 1};
+            ridges.clear();
+            for (int nf : new_facets)
+            {
+                for (int k = 0; k < d; k++)
+                {
+                    if (pool.neighbours[nf * d + k] >= 0)
+                    {
+                        continue;
+                    }
+                    size_t start {ridges.size()};
+                    for (int j = 0; j < d; j++)
+                    {
+                        if (j != k)
+                        {
+                            ridges.push_back(pool.vertices[nf * d + j]);
+                        }
+                    }
+                    std::sort(ridges.begin() + start, ridges.end());
+                    ridges.push_back(nf);
+                    ridges.push_back(k);
+                }
+            }
+            int open {(int) ridges.size() / stride};
+            ridge_order.resize(open);
+            for (int r = 0; r < open; r++)
+            {
+                ridge_order[r] = r * stride;
+            }
+            std::sort(ridge_order.begin(), ridge_order.end(), [&ridges, d](int a, int b)
+            {
+                return std::lexicographical_compare(ridges.begin() + a, ridges.begin() + a + d - 1,
+                                                    ridges.begin() + b, ridges.begin() + b + d - 1);
+            });
+            for (int r = 0; r + 1 < open; r++)
+            {
+                int a {ridge_order[r]};
+                int b {ridge_order[r + 1]};
+                if (std::equal(ridges.begin() + a, ridges.begin() + a + d - 1, ridges.begin() + b))
+                {
+                    pool.neighbours[ridges[a + d - 1] * d + ridges[a + d]] = ridges[b + d - 1];
+                    pool.neighbours[ridges[b + d - 1] * d + ridges[b + d]] = ridges[a + d - 1];
+                    r++;
+                }
+            }
+
+            // hand the outside points of the deleted facets to the new ones
+            for (int v : visible)
+            {
+                for (int p : pool.outside[v])
+                {
+                    if (p != apex)
+                    {
+                        assign_outside(p, new_facets);
+                    }
+                }
+                pool.release(v);
+            }
+            for (int nf : new_facets)
+            {
+                if (!pool.outside[nf].empty())
+                {
+                    pending.push_back(nf);
+                }
+            }
+        }
+        canonicalise_facets();
+    }
+
+    void canonicalise_facets()
+    /*
+    Sort the vertices of every facet into increasing order, moving each neighbour with the vertex it is opposite.
+    Together with the facet order of hull_facets this makes the output independent of the order of construction.
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        int d {dimension};
+        std::vector<std::pair<int, int> > slots (d);
+        for (int f = 0; f < (int) pool.alive.size(); f++)
+        {
+            if (pool.alive[f] == 0)
+            {
+                continue;
+            }
+            for (int i = 0; i < d; i++)
+            {
+                slots[i] = std::make_pair(pool.vertices[f * d + i], pool.neighbours[f * d + i]);
+            }
+            std::sort(slots.begin(), slots.end());
+            for (int i = 0; i < d; i++)
+            {
+                pool.vertices[f * d + i] = slots[i].first;
+                pool.neighbours[f * d + i] = slots[i].second;
+            }
+        }
+    }
+
+    std::vector<int> hull_facets() const
+    /*
+    List the facets of the finished hull, in lexicographic order of their vertices
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    facets : vector<int>
+        pool indices of the facets on the hull
+    */
+
+    {
+        std::vector<int> facets {};
+        for (int f = 0; f < (int) pool.alive.size(); f++)
+        {
+            if (pool.alive[f] == 1)
+            {
+                facets.push_back(f);
+            }
+        }
+        int d {dimension};
+        const std::vector<int>& vertices {pool.vertices};
+        std::sort(facets.begin(), facets.end(), [&vertices, d](int a, int b)
+        {
+            return std::lexicographical_compare(vertices.begin() + a * d, vertices.begin() + (a + 1) * d,
+                                                vertices.begin() + b * d, vertices.begin() + (b + 1) * d);
+        });
+        return facets;
+    }
+
+    std::vector<int> hull_vertices() const
+    /*
+    List the points on the finished hull
+
+    Parameters
+    ----------
+    None
+
+    Returns
+    -------
+    vertices : vector<int>
+        sorted indices of the points which are vertices of the hull
+    */
+
+    {
+        std::vector<char> on_hull (n_points, 0);
+        for (int f : hull_facets())
+        {
+            for (int i = 0; i < dimension; i++)
+            {
+                on_hull[pool.vertices[f * dimension + i]] = 1;
+            }
+        }
+        std::vector<int> vertices {};
+        for (int p = 0; p < n_points; p++)
+        {
+            if (on_hull[p] == 1)
+            {
+                vertices.push_back(p);
+            }
+        }
+        return vertices;
+    }
+};
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+struct random_stream
+/*
+A structure to represent an independent stream of random numbers (xoshiro256**).
+R's generator cannot be called from several threads at once, so parallel routines draw one seed from R ...
+... and give each block of work its own stream, numbered so the results do not depend on the number of threads.
+
+Attributes
+----------
+state : uint64_t[4]
+    state of the generator
+
+Methods
+-------
+next:
+    next 64 random bits
+uniform:
+    next uniform number in [0, 1)
+*/
+{
+    uint64_t state[4] {};
+
+    random_stream(uint64_t seed, uint64_t stream)
+    /*
+    Initialise instance of the random_stream structure, filling the state by splitmix64
+
+    Parameters
+    ----------
+    seed : uint64_t
+        seed shared by every stream, e.g. drawn from R
+    stream : uint64_t
+        number of the stream
+
+    Returns
+    -------
+    None
+    */
+
+    {
+        uint64_t z {seed ^ (stream * 0xD1B54A32D192ED03ULL)};
+        for (int i = 0; i < 4; i++)
+        {
+            z += 0x9E3779B97F4A7C15ULL;
+            uint64_t mixed {z};
+            mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+            state[i] = mixed ^ (mixed >> 31);
+        }
+    }
+
+    static uint64_t rotate(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    uint64_t next()
+    {
+        uint64_t result {rotate(state[1] * 5, 7) * 9};
+        uint64_t t {state[1] << 17};
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotate(state[3], 45);
+        return result;
+    }
+
+    double uniform()
+    {
+        return (next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+};
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef RCPPASSIGNMENT_TYPES_H
+#define RCPPASSIGNMENT_TYPES_H
+
+// native types passed to and from R as external pointers, included by RcppExports.cpp
+#include "dynamic_hull.h"
+#include "line_envelope.h"
+
+#endif
@@ -0,0 +1,105 @@
+#include <vector>
+
+#include "monotone_chain.h"
+#include "skyline.h"
+#include "groups.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+IntegerVector skyline(NumericVector x, NumericVector y, bool maximise_x = true, bool maximise_y = true)
+/*
+Find the Pareto frontier (skyline) of a point set (for R package build).
+Points are read in place; the cost is O(n log n), or O(n) if they are already sorted by x then y.
+
+Parameters
+----------
+x : NumericVector
+    x coords
+y : NumericVector
+    y coords
+maximise_x, maximise_y : bool
+    whether larger or smaller values of each coordinate are better
+
+Returns
+-------
+frontier : IntegerVector
+    positions of the points on the frontier in x, y (1-based), in increasing order of x
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n)
+    {
+        stop("x and y must have the same length");
+    }
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    std::vector<int> frontier {pareto_frontier(px, py, sort_points(px, py, n), maximise_x, maximise_y)};
+    for (int& i : frontier)
+    {
+        i++;
+    }
+    return IntegerVector(frontier.begin(), frontier.end());
+}
+
+// [[Rcpp::export]]
+List skyline_grouped(NumericVector x, NumericVector y, IntegerVector group, bool maximise_x = true, bool maximise_y = true)
+/*
+Find the Pareto frontier (skyline) of each group of points (for R package build).
+Groups are processed in parallel, reading the points in place.
+
+Parameters
+----------
+x, y : NumericVector
+    coordinates of the points
+group : IntegerVector
+    group of each point; the points of each group must be in consecutive rows
+maximise_x, maximise_y : bool
+    whether larger or smaller values of each coordinate are better
+
+Returns
+-------
+frontiers : List
+    group : IntegerVector
+        group value of each frontier point, so the frontiers form a grouped result
+    index : IntegerVector
+        position of each frontier point in x, y (1-based), in increasing order of x within each group
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n || group.size() != n)
+    {
+        stop("x, y and group must have the same length");
+    }
+    std::vector<int> starts {find_group_starts(group.begin(), n)};
+    int n_groups {(int) starts.size() - 1};
+
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+    std::vector<std::vector<int> > frontiers (n_groups);
+    #pragma omp parallel for schedule(dynamic)
+    for (int g = 0; g < n_groups; g++)
+    {
+        const double* gx {px + starts[g]};
+        const double* gy {py + starts[g]};
+        int size {starts[g + 1] - starts[g]};
+        frontiers[g] = pareto_frontier(gx, gy, sort_points(gx, gy, size), maximise_x, maximise_y);
+    }
+
+    // output
+    std::vector<int> group_out {};
+    std::vector<int> index {};
+    for (int g = 0; g < n_groups; g++)
+    {
+        for (int i : frontiers[g])
+        {
+            group_out.push_back(group[starts[g]]);
+            index.push_back(starts[g] + i + 1);
+        }
+    }
+    return List::create(Named("group") = group_out,
+                        Named("index") = index);
+}
@@ -0,0 +1,73 @@
+#ifndef SKYLINE_H
+#define SKYLINE_H
+
+#include <vector>
+#include <algorithm>
+
+#include "monotone_chain.h"
+
+inline std::vector<int> pareto_frontier(const double* x, const double* y, const std::vector<int>& order,
+                                        bool maximise_x, bool maximise_y)
+/*
+Finds the Pareto frontier (skyline) of presorted points in O(n), sharing the sort stage of the monotone chain.
+A point is on the frontier if no other point is at least as good in both coordinates and better in one. ...
+... Points are scanned from the best x-coordinate to the worst; of each run with equal x only the best y ...
+... can be on the frontier, and it is if it beats every y seen so far. Repeated points are reported once.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the points
+order : vector<int>
+    indices of the points, from sort_points
+maximise_x, maximise_y : bool
+    whether larger or smaller values of each coordinate are better
+
+Returns
+-------
+frontier : vector<int>
+    indices of the points on the frontier, in increasing order of x-coordinate
+*/
+
+{
+    int n {(int) order.size()};
+    // runs of points with equal x-coordinate
+    std::vector<int> runs {};
+    for (int r = 0; r < n; r++)
+    {
+        if (r == 0 || x[order[r]] != x[order[r - 1]])
+        {
+            runs.push_back(r);
+        }
+    }
+    runs.push_back(n);
+
+    std::vector<int> frontier {};
+    int n_runs {(int) runs.size() - 1};
+    for (int k = 0; k < n_runs; k++)
+    {
+        int run {maximise_x ? n_runs - 1 - k : k};
+        // best y in the run, taking the first of any repeats
+        int best {runs[run]};
+        if (maximise_y)
+        {
+            best = runs[run + 1] - 1;
+            while (best > runs[run] && y[order[best - 1]] == y[order[best]])
+            {
+                best--;
+            }
+        }
+        int candidate {order[best]};
+        if (frontier.empty() || (maximise_y ? y[candidate] > y[frontier.back()] : y[candidate] < y[frontier.back()]))
+        {
+            frontier.push_back(candidate);
+        }
+    }
+    if (maximise_x)
+    {
+        std::reverse(frontier.begin(), frontier.end());
+    }
+    return frontier;
+}
+
+#endif
@@ -0,0 +1,203 @@
+#include <vector>
+#include <string>
+#include <fstream>
+#include <algorithm>
+
+#include "wkb.h"
+#include "groups.h"
+
+#include<Rcpp.h>
+using namespace Rcpp;
+
+std::vector<int> polygon_starts(NumericVector x, NumericVector y, Nullable<IntegerVector> group)
+/*
+Find where each polygon starts in a set of vertices, checking the inputs
+
+Parameters
+----------
+x, y : NumericVector
+    coordinates of the vertices
+group : Nullable<IntegerVector>
+    polygon of each vertex, a run of consecutive rows per polygon; NULL for a single polygon
+
+Returns
+-------
+starts : vector<int>
+    first row of each polygon, followed by the number of rows
+*/
+
+{
+    int n {(int) x.size()};
+    if (y.size() != n)
+    {
+        stop("x and y must have the same length");
+    }
+    if (group.isNull())
+    {
+        return std::vector<int> {0, n};
+    }
+    IntegerVector groups(group.get());
+    if (groups.size() != n)
+    {
+        stop("group must have the same length as x and y");
+    }
+    return find_group_starts(groups.begin(), n);
+}
+
+// [[Rcpp::export]]
+List hulls_to_wkb(NumericVector x, NumericVector y, Nullable<IntegerVector> group = R_NilValue)
+/*
+Encode hulls as WKB polygons (for R package build). Hulls with fewer than three distinct vertices ...
+... are written as an empty polygon, a point or a line string, so every geometry is valid.
+Each geometry's size is known in advance, so the raw vectors are allocated first and then filled in parallel. ...
+... Rings are closed if they are not already.
+
+Parameters
+----------
+x : NumericVector
+    x coords of the hull vertices, in order around each hull, e.g. from enclosing_polygons
+y : NumericVector
+    y coords of the hull vertices
+group : IntegerVector or NULL
+    hull of each vertex, a run of consecutive rows per hull; NULL for a single hull
+
+Returns
+-------
+wkb : List
+    one raw vector per hull
+*/
+
+{
+    std::vector<int> starts {polygon_starts(x, y, group)};
+    int polygons {(int) starts.size() - 1};
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+
+    List wkb(polygons);
+    std::vector<unsigned char*> out (polygons);
+    for (int g = 0; g < polygons; g++)
+    {
+        RawVector bytes(wkb_hull_size(px, py, starts[g], starts[g + 1]));
+        out[g] = bytes.begin();
+        wkb[g] = bytes;
+    }
+    #pragma omp parallel for schedule(static)
+    for (int g = 0; g < polygons; g++)
+    {
+        write_wkb_hull(px, py, starts[g], starts[g + 1], out[g]);
+    }
+    return wkb;
+}
+
+// [[Rcpp::export]]
+CharacterVector hulls_to_wkt(NumericVector x, NumericVector y, Nullable<IntegerVector> group = R_NilValue)
+/*
+Encode hulls as WKT polygons, in parallel (for R package build). Hulls with fewer than three distinct ...
+... vertices are written as an empty polygon, a point or a line string, so every geometry is valid.
+
+Parameters
+----------
+x : NumericVector
+    x coords of the hull vertices, in order around each hull, e.g. from enclosing_polygons
+y : NumericVector
+    y coords of the hull vertices
+group : IntegerVector or NULL
+    hull of each vertex, a run of consecutive rows per hull; NULL for a single hull
+
+Returns
+-------
+wkt : CharacterVector
+    one string per hull
+*/
+
+{
+    std::vector<int> starts {polygon_starts(x, y, group)};
+    int polygons {(int) starts.size() - 1};
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+
+    std::vector<std::string> text (polygons);
+    #pragma omp parallel for schedule(static)
+    for (int g = 0; g < polygons; g++)
+    {
+        text[g] = wkt_hull(px, py, starts[g], starts[g + 1]);
+    }
+    CharacterVector wkt(polygons);
+    for (int g = 0; g < polygons; g++)
+    {
+        wkt[g] = text[g];
+    }
+    return wkt;
+}
+
+// [[Rcpp::export]]
+void write_hulls(NumericVector x, NumericVector y, std::string file, Nullable<IntegerVector> group = R_NilValue,
+                 std::string format = "wkb")
+/*
+Write hulls to a file, one geometry per line, as hexadecimal WKB or as WKT (for R package build).
+Hulls are encoded in parallel in blocks and each block is written as it is finished, ...
+... so no R objects are created and memory use does not grow with the number of hulls.
+
+Parameters
+----------
+x : NumericVector
+    x coords of the hull vertices, in order around each hull, e.g. from enclosing_polygons
+y : NumericVector
+    y coords of the hull vertices
+file : std::string
+    path of the file, which is overwritten
+group : IntegerVector or NULL
+    hull of each vertex, a run of consecutive rows per hull; NULL for a single hull
+format : std::string
+    "wkb" for hexadecimal WKB or "wkt"
+
+Returns
+-------
+None
+*/
+
+{
+    if (format != "wkb" && format != "wkt")
+    {
+        stop("format must be \"wkb\" or \"wkt\"");
+    }
+    bool binary {format == "wkb"};
+    std::vector<int> starts {polygon_starts(x, y, group)};
+    int polygons {(int) starts.size() - 1};
+    const double* px {x.begin()};
+    const double* py {y.begin()};
+
+    std::ofstream output(file, std::ios::binary);
+    if (!output)
+    {
+        stop("cannot open file for writing");
+    }
+    const int block {4096};
+    std::vector<std::string> text (block);
+    for (int first = 0; first < polygons; first += block)
+    {
+        int last {std::min(polygons, first + block)};
+        #pragma omp parallel for schedule(static)
+        for (int g = first; g < last; g++)
+        {
+            if (binary)
+            {
+                std::vector<unsigned char> bytes (wkb_hull_size(px, py, starts[g], starts[g + 1]));
+                write_wkb_hull(px, py, starts[g], starts[g + 1], bytes.data());
+                text[g - first] = hex_string(bytes.data(), bytes.size());
+            }
+            else
+            {
+                text[g - first] = wkt_hull(px, py, starts[g], starts[g + 1]);
+            }
+        }
+        for (int g = first; g < last; g++)
+        {
+            output << text[g - first] << '\n';
+        }
+    }
+    if (!output)
+    {
+        stop("error writing file");
+    }
+}
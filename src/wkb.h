@@ -0,0 +1,257 @@
+#ifndef WKB_H
+#define WKB_H
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+
+inline bool closed_ring(const double* x, const double* y, int start, int end)
+/*
+Tests whether a ring is given closed, i.e. with its first vertex repeated at the end
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the vertices
+start, end : int
+    the ring occupies rows start to end - 1
+
+Returns
+-------
+closed : bool
+*/
+
+{
+    return end - start >= 2 && x[start] == x[end - 1] && y[start] == y[end - 1];
+}
+
+inline int distinct_vertices(const double* x, const double* y, int start, int end, int& second)
+/*
+Count the distinct vertices of a ring, stopping at three
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the vertices
+start, end : int
+    the ring occupies rows start to end - 1
+second : int&
+    set to the first row differing from the first vertex, if any
+
+Returns
+-------
+count : int
+    0, 1, 2 or 3 (for three or more)
+*/
+
+{
+    if (start == end)
+    {
+        return 0;
+    }
+    int count {1};
+    for (int i = start + 1; i < end; i++)
+    {
+        if (x[i] == x[start] && y[i] == y[start])
+        {
+            continue;
+        }
+        if (count == 1)
+        {
+            second = i;
+            count = 2;
+        }
+        else if (x[i] != x[second] || y[i] != y[second])
+        {
+            return 3;
+        }
+    }
+    return count;
+}
+
+/*
+A hull is written as a polygon with one ring, closed if it is not already. A polygon needs at least ...
+... three distinct vertices, so hulls with fewer are written as what they are: an empty polygon, ...
+... a point, or a line string between their two distinct vertices.
+*/
+
+inline size_t wkb_hull_size(const double* x, const double* y, int start, int end)
+/*
+Number of bytes in the WKB encoding of a hull
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the vertices
+start, end : int
+    the hull occupies rows start to end - 1
+
+Returns
+-------
+size : size_t
+*/
+
+{
+    int second {};
+    switch (distinct_vertices(x, y, start, end, second))
+    {
+        case 0:
+            return 9;
+        case 1:
+            return 21;
+        case 2:
+            return 41;
+    }
+    int vertices {end - start + (closed_ring(x, y, start, end) ? 0 : 1)};
+    return 13 + 16 * (size_t) vertices;
+}
+
+inline void write_wkb_hull(const double* x, const double* y, int start, int end, unsigned char* out)
+/*
+Encode a hull as WKB, in the byte order of the host
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the vertices
+start, end : int
+    the hull occupies rows start to end - 1
+out : unsigned char*
+    where to write the wkb_hull_size bytes
+
+Returns
+-------
+None
+*/
+
+{
+    const uint16_t probe {1};
+    unsigned char byte_order {};
+    std::memcpy(&byte_order, &probe, 1);
+    auto put_int = [&out](uint32_t value)
+    {
+        std::memcpy(out, &value, 4);
+        out += 4;
+    };
+    auto put_point = [&out](double px, double py)
+    {
+        std::memcpy(out, &px, 8);
+        std::memcpy(out + 8, &py, 8);
+        out += 16;
+    };
+
+    *out++ = byte_order;
+    int second {};
+    switch (distinct_vertices(x, y, start, end, second))
+    {
+        case 0:
+            put_int(3); // polygon, no rings
+            put_int(0);
+            return;
+        case 1:
+            put_int(1); // point
+            put_point(x[start], y[start]);
+            return;
+        case 2:
+            put_int(2); // line string
+            put_int(2);
+            put_point(x[start], y[start]);
+            put_point(x[second], y[second]);
+            return;
+    }
+    bool closed {closed_ring(x, y, start, end)};
+    put_int(3); // polygon
+    put_int(1);
+    put_int(end - start + (closed ? 0 : 1));
+    for (int i = start; i < end; i++)
+    {
+        put_point(x[i], y[i]);
+    }
+    if (!closed)
+    {
+        put_point(x[start], y[start]);
+    }
+}
+
+inline std::string wkt_hull(const double* x, const double* y, int start, int end)
+/*
+Encode a hull as WKT.
+Coordinates are written with 17 significant digits, so they read back exactly.
+
+Parameters
+----------
+x, y : const double*
+    coordinates of the vertices
+start, end : int
+    the hull occupies rows start to end - 1
+
+Returns
+-------
+wkt : string
+*/
+
+{
+    char buffer[128];
+    int second {};
+    switch (distinct_vertices(x, y, start, end, second))
+    {
+        case 0:
+            return "POLYGON EMPTY";
+        case 1:
+            std::snprintf(buffer, sizeof(buffer), "POINT (%.17g %.17g)", x[start], y[start]);
+            return buffer;
+        case 2:
+        {
+            std::string wkt {"LINESTRING ("};
+            std::snprintf(buffer, sizeof(buffer), "%.17g %.17g, ", x[start], y[start]);
+            wkt += buffer;
+            std::snprintf(buffer, sizeof(buffer), "%.17g %.17g)", x[second], y[second]);
+            return wkt + buffer;
+        }
+    }
+    std::string wkt {"POLYGON (("};
+    bool closed {closed_ring(x, y, start, end)};
+    for (int i = start; i <= end; i++)
+    {
+        if (i == end && closed)
+        {
+            break;
+        }
+        int j {i == end ? start : i};
+        std::snprintf(buffer, sizeof(buffer), "%s%.17g %.17g", i == start ? "" : ", ", x[j], y[j]);
+        wkt += buffer;
+    }
+    wkt += "))";
+    return wkt;
+}
+
+inline std::string hex_string(const unsigned char* bytes, size_t size)
+/*
+Encode bytes as upper-case hexadecimal, the text form of WKB read by most GIS tools
+
+Parameters
+----------
+bytes : const unsigned char*
+    the bytes
+size : size_t
+    number of bytes
+
+Returns
+-------
+hex : string
+*/
+
+{
+    static const char digits[] {"0123456789ABCDEF"};
+    std::string hex (2 * size, '0');
+    for (size_t i = 0; i < size; i++)
+    {
+        hex[2 * i] = digits[bytes[i] >> 4];
+        hex[2 * i + 1] = digits[bytes[i] & 15];
+    }
+    return hex;
+}
+
+#endif